@@ -8,9 +8,12 @@ public class GGJ2026 : ModuleRules
 	{
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 	
-		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore" , "Paper2D", "PaperZD", "EnhancedInput", "UMG", "AIModule" });
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore" , "Paper2D", "PaperZD", "EnhancedInput", "UMG", "AIModule", "NavigationSystem" });
 
-		PrivateDependencyModuleNames.AddRange(new string[] {  });
+		PrivateDependencyModuleNames.AddRange(new string[] { "Chaos", "PhysicsCore", "Json", "ImageCore" });
+
+		// Adds the GameplayDebugger module and WITH_GAMEPLAY_DEBUGGER outside of Shipping
+		SetupGameplayDebuggerSupport(Target);
 
 		// Uncomment if you are using Slate UI
 		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
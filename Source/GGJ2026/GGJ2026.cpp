@@ -2,5 +2,39 @@
 
 #include "GGJ2026.h"
 #include "Modules/ModuleManager.h"
+#include "Debug/CombatTelemetry.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, GGJ2026, "GGJ2026" );
+#if WITH_GAMEPLAY_DEBUGGER
+#include "GameplayDebugger.h"
+#include "Debug/GameplayDebuggerCategory_GGJ.h"
+#endif
+
+class FGGJ2026Module : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override
+	{
+#if WITH_GAMEPLAY_DEBUGGER
+		IGameplayDebugger& GameplayDebugger = IGameplayDebugger::Get();
+		GameplayDebugger.RegisterCategory(TEXT("GGJ"), IGameplayDebugger::FOnGetCategory::CreateStatic(&FGameplayDebuggerCategory_GGJ::MakeInstance), EGameplayDebuggerCategoryState::EnabledInGameAndSimulate, 5);
+		GameplayDebugger.NotifyCategoriesChanged();
+#endif
+	}
+
+	virtual void ShutdownModule() override
+	{
+		// Joins the writer thread if a recording is still open
+		FGGJCombatTelemetry::Stop();
+
+#if WITH_GAMEPLAY_DEBUGGER
+		if (IGameplayDebugger::IsAvailable())
+		{
+			IGameplayDebugger& GameplayDebugger = IGameplayDebugger::Get();
+			GameplayDebugger.UnregisterCategory(TEXT("GGJ"));
+			GameplayDebugger.NotifyCategoriesChanged();
+		}
+#endif
+	}
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FGGJ2026Module, GGJ2026, "GGJ2026" );
@@ -4,16 +4,49 @@
 #include "AI/EnemyAIController.h"
 
 #include "BrainComponent.h"
-#include "Navigation/CrowdFollowingComponent.h"
+#include "AI/EnemyPathBroker.h"
+#include "AI/EnemyPathFollowingComponent.h"
+#include "AI/EnemySteeringSubsystem.h"
+#include "Game/GGJStats.h"
+
+static TAutoConsoleVariable<bool> CVarEnemyBrokeredMoves(
+	TEXT("ggj.AI.BrokeredMoves"),
+	true,
+	TEXT("Route behavior tree MoveTo paths for enemies through the path broker instead of a synchronous query."));
+
+AEnemyAIController::AEnemyAIController(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UEnemyPathFollowingComponent>(TEXT("PathFollowingComponent")))
+{
+}
 
 void AEnemyAIController::BeginPlay()
 {
+	LLM_SCOPE_BYTAG(GGJ_AI);
+
 	Super::BeginPlay();
 
 	if (UCrowdFollowingComponent* Crowd = FindComponentByClass<UCrowdFollowingComponent>())
 	{
 		Crowd->SetCrowdAvoidanceQuality(ECrowdAvoidanceQuality::Medium);
 	}
+
+	SetSteeringBackend(SteeringBackend);
+}
+
+void AEnemyAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UEnemySteeringSubsystem* Steering = GetWorld()->GetSubsystem<UEnemySteeringSubsystem>())
+	{
+		Steering->UnregisterAgent(GetEnemyPathFollowing());
+	}
+
+	if (UEnemyPathBroker* PathBroker = GetWorld()->GetSubsystem<UEnemyPathBroker>())
+	{
+		PathBroker->CancelRequests(this);
+	}
+	PendingPathRequestId = 0;
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AEnemyAIController::OnPossess(APawn* InPawn)
@@ -23,6 +56,9 @@ void AEnemyAIController::OnPossess(APawn* InPawn)
 
 void AEnemyAIController::ActivateEnemyBT(bool IsEnemyReset)
 {
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJAIController, AI);
+	LLM_SCOPE_BYTAG(GGJ_AI);
+	
 	if (IsEnemyReset)
 	{
 		BrainComponent->RestartLogic();
@@ -37,3 +73,140 @@ void AEnemyAIController::DeactivateEnemyBT()
 {
 	BrainComponent->StopLogic("");
 }
+
+void AEnemyAIController::SetSteeringBackend(EEnemySteeringBackend NewBackend)
+{
+	SteeringBackend = NewBackend;
+
+	UEnemyPathFollowingComponent* PathFollowing = GetEnemyPathFollowing();
+	UEnemySteeringSubsystem* Steering = GetWorld()->GetSubsystem<UEnemySteeringSubsystem>();
+	if (!PathFollowing || !Steering) return;
+
+	const bool bUseSpatialHash = SteeringBackend == EEnemySteeringBackend::SpatialHash;
+	PathFollowing->SetUseSpatialHashSteering(bUseSpatialHash);
+
+	if (bUseSpatialHash)
+	{
+		Steering->RegisterAgent(PathFollowing);
+	}
+	else
+	{
+		Steering->UnregisterAgent(PathFollowing);
+	}
+}
+
+UEnemyPathFollowingComponent* AEnemyAIController::GetEnemyPathFollowing() const
+{
+	return Cast<UEnemyPathFollowingComponent>(GetPathFollowingComponent());
+}
+
+FPathFollowingRequestResult AEnemyAIController::MoveTo(const FAIMoveRequest& MoveRequest, FNavPathSharedPtr* OutPath)
+{
+	// Callers that want the path back, like UAITask_MoveTo, still get a synchronous query. A move already at its
+	// goal needs no query at all, the base class reports it.
+	UPathFollowingComponent* PathFollowing = GetPathFollowingComponent();
+	if (!CVarEnemyBrokeredMoves.GetValueOnGameThread() || OutPath || !MoveRequest.IsValid() || !MoveRequest.IsUsingPathfinding()
+		|| !PathFollowing || !GetPawn() || !GetWorld()->GetSubsystem<UEnemyPathBroker>() || PathFollowing->HasReached(MoveRequest))
+	{
+		CancelBrokeredMove(FPathFollowingResultFlags::NewRequest);
+		return Super::MoveTo(MoveRequest, OutPath);
+	}
+
+	// The current move ends now, like it would when a synchronous path replaced it
+	if (PathFollowing->GetStatus() != EPathFollowingStatus::Idle)
+	{
+		PathFollowing->AbortMove(*this, FPathFollowingResultFlags::NewRequest);
+	}
+
+	RequestBrokeredMove(MoveRequest);
+
+	FPathFollowingRequestResult Result;
+	Result.Code = EPathFollowingRequestResult::RequestSuccessful;
+	Result.MoveId = FAIRequestID::AnyRequest;
+	return Result;
+}
+
+void AEnemyAIController::StopMovement()
+{
+	CancelBrokeredMove(FPathFollowingResultFlags::UserAbort);
+
+	Super::StopMovement();
+}
+
+void AEnemyAIController::MoveToLocationBrokered(const FVector& Goal, float AcceptanceRadius)
+{
+	FAIMoveRequest MoveReq(Goal);
+	MoveReq.SetAcceptanceRadius(AcceptanceRadius);
+	MoveReq.SetUsePathfinding(true);
+
+	RequestBrokeredMove(MoveReq);
+}
+
+void AEnemyAIController::MoveToActorBrokered(AActor* Goal, float AcceptanceRadius)
+{
+	if (!Goal) return;
+
+	FAIMoveRequest MoveReq(Goal);
+	MoveReq.SetAcceptanceRadius(AcceptanceRadius);
+	MoveReq.SetUsePathfinding(true);
+
+	RequestBrokeredMove(MoveReq);
+}
+
+void AEnemyAIController::RequestBrokeredMove(const FAIMoveRequest& MoveRequest)
+{
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJAIController, AI);
+
+	const APawn* ControlledPawn = GetPawn();
+	UEnemyPathBroker* PathBroker = GetWorld()->GetSubsystem<UEnemyPathBroker>();
+	if (!ControlledPawn || !PathBroker) return;
+
+	// Only the latest request matters, an older one would just overwrite this move later
+	CancelBrokeredMove(FPathFollowingResultFlags::NewRequest);
+
+	PendingMoveRequest = MoveRequest;
+	PendingPathRequestId = PathBroker->RequestPath(this, ControlledPawn->GetNavAgentLocation(), MoveRequest.GetDestination(),
+		FOnEnemyPathReady::CreateUObject(this, &AEnemyAIController::OnBrokeredPathReady));
+}
+
+void AEnemyAIController::CancelBrokeredMove(FPathFollowingResultFlags::Type Flags)
+{
+	if (PendingPathRequestId == 0) return;
+	PendingPathRequestId = 0;
+
+	if (UEnemyPathBroker* PathBroker = GetWorld()->GetSubsystem<UEnemyPathBroker>())
+	{
+		PathBroker->CancelRequests(this);
+	}
+
+	if (UPathFollowingComponent* PathFollowing = GetPathFollowingComponent())
+	{
+		PathFollowing->OnRequestFinished.Broadcast(FAIRequestID::AnyRequest, FPathFollowingResult(EPathFollowingResult::Aborted, Flags));
+	}
+}
+
+void AEnemyAIController::OnBrokeredPathReady(uint32 RequestId, bool bSuccess, FNavPathSharedPtr Path)
+{
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJAIController, AI);
+
+	if (RequestId != PendingPathRequestId) return;
+	PendingPathRequestId = 0;
+
+	if (!bSuccess || !Path.IsValid())
+	{
+		if (UPathFollowingComponent* PathFollowing = GetPathFollowingComponent())
+		{
+			PathFollowing->OnRequestFinished.Broadcast(FAIRequestID::AnyRequest, FPathFollowingResult(EPathFollowingResult::Invalid, FPathFollowingResultFlags::InvalidPath));
+		}
+		return;
+	}
+
+	// Same setup the synchronous MoveTo gives its path
+	Path->EnableRecalculationOnInvalidation(true);
+	if (AActor* GoalActor = PendingMoveRequest.GetGoalActor())
+	{
+		Path->SetGoalActorObservation(*GoalActor, 100.0f);
+	}
+
+	RequestMove(PendingMoveRequest, Path);
+}
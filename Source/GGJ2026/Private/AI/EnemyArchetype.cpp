@@ -0,0 +1,21 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/EnemyArchetype.h"
+
+const FPrimaryAssetType UEnemyArchetype::PrimaryAssetType(TEXT("EnemyArchetype"));
+
+FPrimaryAssetId UEnemyArchetype::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(PrimaryAssetType, GetFName());
+}
+
+FEnemyArchetypeData UEnemyArchetype::MakeData() const
+{
+	FEnemyArchetypeData Data;
+	Data.Damage = Damage;
+	Data.KnockBackStrength = KnockBackStrength;
+	Data.ScorePoints = ScorePoints;
+	Data.Type = Type;
+	return Data;
+}
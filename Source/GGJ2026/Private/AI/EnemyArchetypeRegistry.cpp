@@ -0,0 +1,146 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/EnemyArchetypeRegistry.h"
+
+#include "Characters/EnemyCharacter.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Kismet/GameplayStatics.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGGJArchetype, Log, All);
+
+static const FEnemyArchetypeData DefaultArchetypeData;
+
+void UEnemyArchetypeRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TArray<UEnemyArchetype*> Loaded;
+
+	// A handful of small assets, loading them up front keeps spawning free of loads
+	if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+	{
+		TArray<FSoftObjectPath> Paths;
+		AssetManager->GetPrimaryAssetPathList(UEnemyArchetype::PrimaryAssetType, Paths);
+
+		for (const FSoftObjectPath& Path : Paths)
+		{
+			if (UEnemyArchetype* Archetype = Cast<UEnemyArchetype>(Path.TryLoad()))
+			{
+				Loaded.Add(Archetype);
+			}
+		}
+	}
+
+	// Maskless enemies (None) are part of every spawn mix but need no asset, only the mask types warn
+	for (uint8 i = 0; i <= static_cast<uint8>(EEnemyType::BlueCat); ++i)
+	{
+		const EEnemyType Type = static_cast<EEnemyType>(i);
+		if (!Loaded.ContainsByPredicate([Type](const UEnemyArchetype* Archetype) { return Archetype->Type == Type; }))
+		{
+			if (Type != EEnemyType::None)
+			{
+				UE_LOG(LogGGJArchetype, Warning, TEXT("No enemy archetype asset for %s, it takes the values set on each enemy."), *UEnum::GetValueAsString(Type));
+			}
+
+			UEnemyArchetype* Fallback = NewObject<UEnemyArchetype>(this, NAME_None, RF_Transient);
+			Fallback->Type = Type;
+			Loaded.Add(Fallback);
+		}
+	}
+
+	Loaded.Sort([](const UEnemyArchetype& A, const UEnemyArchetype& B)
+	{
+		if (A.Type != B.Type) return A.Type < B.Type;
+		return A.GetFName().LexicalLess(B.GetFName());
+	});
+
+	Archetypes.Reserve(Loaded.Num());
+	ArchetypeData.Reserve(Loaded.Num());
+	for (UEnemyArchetype* Archetype : Loaded)
+	{
+		AddArchetype(Archetype);
+	}
+}
+
+void UEnemyArchetypeRegistry::Deinitialize()
+{
+	Archetypes.Empty();
+	ArchetypeData.Empty();
+
+	Super::Deinitialize();
+}
+
+void UEnemyArchetypeRegistry::AddArchetype(UEnemyArchetype* Archetype)
+{
+	Archetypes.Add(Archetype);
+	ArchetypeData.Add(Archetype->MakeData());
+}
+
+int32 UEnemyArchetypeRegistry::ResolveLegacyArchetype(const AEnemyCharacter* Enemy, int32 Index)
+{
+	const UEnemyArchetype* Base = GetArchetype(Index);
+	if (!Enemy || !Base || !Base->HasAnyFlags(RF_Transient)) return Index;
+
+	const EEnemyType Type = Base->Type;
+	const TSubclassOf<AMaskPickup> PickupClass = Enemy->PickupClass && Enemy->PickupClass->IsChildOf<AMaskPickup>() ? Enemy->PickupClass : nullptr;
+
+	UPaperFlipbook* MaskFlipbook = nullptr;
+	switch (Type)
+	{
+	case EEnemyType::RedRabbit: MaskFlipbook = Enemy->RedRabbitMaskFlipbook; break;
+	case EEnemyType::GreenBird: MaskFlipbook = Enemy->GreenBirdMaskFlipbook; break;
+	case EEnemyType::BlueCat: MaskFlipbook = Enemy->BlueCatMaskFlipbook; break;
+	default: break;
+	}
+
+	// Enemies of one class normally share an archetype, only classes or level instances with other values add one
+	for (int32 i = 0; i < Archetypes.Num(); ++i)
+	{
+		const UEnemyArchetype* Archetype = Archetypes[i];
+		if (Archetype->Type == Type && Archetype->HasAnyFlags(RF_Transient) && Archetype->Damage == Enemy->Damage
+			&& Archetype->KnockBackStrength == Enemy->KnockBackStrenghth && Archetype->ScorePoints == Enemy->ScorePoints
+			&& Archetype->PickupClass == PickupClass && Archetype->MaskFlipbook == MaskFlipbook)
+		{
+			return i;
+		}
+	}
+
+	UEnemyArchetype* Legacy = NewObject<UEnemyArchetype>(this, NAME_None, RF_Transient);
+	Legacy->Type = Type;
+	Legacy->Damage = Enemy->Damage;
+	Legacy->KnockBackStrength = Enemy->KnockBackStrenghth;
+	Legacy->ScorePoints = Enemy->ScorePoints;
+	Legacy->PickupClass = PickupClass;
+	Legacy->MaskFlipbook = MaskFlipbook;
+	AddArchetype(Legacy);
+
+	UE_LOG(LogGGJArchetype, Log, TEXT("Archetype %d for %s from %s: damage %.1f, knockback %.0f, score %d, pickup %s"),
+		Archetypes.Num() - 1, *UEnum::GetValueAsString(Type), *Enemy->GetName(), Legacy->Damage, Legacy->KnockBackStrength,
+		Legacy->ScorePoints, *GetNameSafe(Legacy->PickupClass));
+
+	return Archetypes.Num() - 1;
+}
+
+UEnemyArchetypeRegistry* UEnemyArchetypeRegistry::Get(const UObject* WorldContextObject)
+{
+	const UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject);
+	return GameInstance ? GameInstance->GetSubsystem<UEnemyArchetypeRegistry>() : nullptr;
+}
+
+int32 UEnemyArchetypeRegistry::FindArchetypeIndex(EEnemyType Type) const
+{
+	return ArchetypeData.IndexOfByPredicate([Type](const FEnemyArchetypeData& Data) { return Data.Type == Type; });
+}
+
+const FEnemyArchetypeData& UEnemyArchetypeRegistry::GetData(int32 Index) const
+{
+	return ArchetypeData.IsValidIndex(Index) ? ArchetypeData[Index] : DefaultArchetypeData;
+}
+
+const FEnemyArchetypeData& UEnemyArchetypeRegistry::GetData(const UObject* WorldContextObject, int32 Index)
+{
+	const UEnemyArchetypeRegistry* Registry = Get(WorldContextObject);
+	return Registry ? Registry->GetData(Index) : DefaultArchetypeData;
+}
@@ -3,6 +3,8 @@
 
 #include "AI/EnemyManager.h"
 
+#include "Game/GGJStats.h"
+
 void UEnemyAttackManager::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -24,7 +26,12 @@ bool UEnemyAttackManager::RequestAttack(AActor* EnemyActor)
 {
 	if (!EnemyActor || (!HasToken(EnemyActor) && ActiveTokenHolders.Num() >= MaxTokens)) return false;
 	
-	if (!HasToken(EnemyActor))	ActiveTokenHolders.Add(EnemyActor);
+	if (!HasToken(EnemyActor))
+	{
+		LLM_SCOPE_BYTAG(GGJ_AI);
+		ActiveTokenHolders.Add(EnemyActor);
+		GGJ_SET_GAUGE(TokenHolders, ActiveTokenHolders.Num());
+	}
 	return true;
 }
 
@@ -37,6 +44,7 @@ void UEnemyAttackManager::ReleaseToken(AActor* EnemyActor)
 			ActiveTokenHolders.Remove(EnemyActor);
 			ActiveTokenHolders.Compact();
 			ActiveTokenHolders.Shrink();
+			GGJ_SET_GAUGE(TokenHolders, ActiveTokenHolders.Num());
 		}
 	}
 }
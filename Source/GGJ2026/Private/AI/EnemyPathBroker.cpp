@@ -0,0 +1,294 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/EnemyPathBroker.h"
+
+#include "NavigationData.h"
+#include "NavigationSystem.h"
+#include "NavMesh/NavMeshPath.h"
+#include "AI/EnemyAIController.h"
+#include "AI/EnemyManager.h"
+#include "Game/GGJStats.h"
+
+void UEnemyPathBroker::Deinitialize()
+{
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		for (const TPair<uint32, uint64>& Query : QueryToBatch)
+		{
+			NavSys->AbortAsyncFindPathRequest(Query.Key);
+		}
+	}
+
+	PendingBatches.Empty();
+	InFlightBatches.Empty();
+	QueryToBatch.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyPathBroker::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyPathBroker, STATGROUP_Tickables);
+}
+
+uint64 UEnemyPathBroker::MakeBatchKey(const FVector& Start, const FVector& Goal) const
+{
+	// 16 bits per axis is +-32k cells, far more than any arena we ship
+	auto Quantize = [this](double Value) -> uint64
+	{
+		return static_cast<uint16>(FMath::FloorToInt32(Value / DedupCellSize));
+	};
+
+	return Quantize(Start.X) | (Quantize(Start.Y) << 16) | (Quantize(Goal.X) << 32) | (Quantize(Goal.Y) << 48);
+}
+
+uint32 UEnemyPathBroker::RequestPath(AEnemyAIController* Requester, const FVector& Start, const FVector& Goal, FOnEnemyPathReady Callback)
+{
+	if (!Requester) return 0;
+
+	FRequest Request;
+	Request.RequestId = NextRequestId++;
+	Request.Requester = Requester;
+	Request.Start = Start;
+	Request.Callback = MoveTemp(Callback);
+	Request.QueuedTime = FPlatformTime::Seconds();
+
+	if (NextRequestId == 0) NextRequestId = 1;
+
+	const uint32 RequestId = Request.RequestId;
+	const uint64 Key = MakeBatchKey(Start, Goal);
+	Stats.TotalRequests++;
+
+	// Join a query that is already running for the same cells
+	if (FBatch* InFlight = InFlightBatches.Find(Key))
+	{
+		InFlight->Requests.Add(MoveTemp(Request));
+		Stats.DedupedRequests++;
+		return RequestId;
+	}
+
+	FBatch* Batch = PendingBatches.Find(Key);
+	if (Batch)
+	{
+		Stats.DedupedRequests++;
+	}
+	else
+	{
+		Batch = &PendingBatches.Add(Key);
+		Batch->Start = Start;
+		Batch->Goal = Goal;
+	}
+
+	Batch->Requests.Add(MoveTemp(Request));
+	return RequestId;
+}
+
+void UEnemyPathBroker::CancelRequests(AEnemyAIController* Requester)
+{
+	auto RemoveFrom = [Requester](TMap<uint64, FBatch>& Batches)
+	{
+		for (TPair<uint64, FBatch>& Pair : Batches)
+		{
+			Pair.Value.Requests.RemoveAllSwap([Requester](const FRequest& Request)
+			{
+				return Request.Requester.Get() == Requester;
+			});
+		}
+	};
+
+	RemoveFrom(PendingBatches);
+	RemoveFrom(InFlightBatches);
+
+	for (auto It = PendingBatches.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Requests.Num() == 0) It.RemoveCurrent();
+	}
+}
+
+float UEnemyPathBroker::ComputePriority(const FBatch& Batch) const
+{
+	const UEnemyAttackManager* AttackManager = GetWorld()->GetSubsystem<UEnemyAttackManager>();
+
+	bool bHasTokenHolder = false;
+	if (AttackManager)
+	{
+		for (const FRequest& Request : Batch.Requests)
+		{
+			const AEnemyAIController* Requester = Request.Requester.Get();
+			if (Requester && AttackManager->HasToken(Requester->GetPawn()))
+			{
+				bHasTokenHolder = true;
+				break;
+			}
+		}
+	}
+
+	// Lower is served first: token holders always beat everyone else, then the closest requests
+	const float Distance = FVector::Dist2D(Batch.Start, Batch.Goal);
+	return bHasTokenHolder ? Distance : Distance + 1.0e7f;
+}
+
+void UEnemyPathBroker::Tick(float DeltaTime)
+{
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJPathBroker, AI);
+	LLM_SCOPE_BYTAG(GGJ_AI);
+
+	Stats.DispatchedLastFrame = 0;
+
+	if (PendingBatches.Num() == 0) return;
+
+	TArray<uint64> Keys;
+	PendingBatches.GenerateKeyArray(Keys);
+
+	for (const uint64 Key : Keys)
+	{
+		FBatch& Batch = PendingBatches[Key];
+		Batch.Priority = ComputePriority(Batch);
+	}
+
+	Keys.Sort([this](uint64 A, uint64 B)
+	{
+		return PendingBatches[A].Priority < PendingBatches[B].Priority;
+	});
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = DispatchBudgetMs / 1000.0;
+
+	for (const uint64 Key : Keys)
+	{
+		if (Stats.DispatchedLastFrame >= MaxDispatchPerFrame) break;
+		if (QueryToBatch.Num() >= MaxInFlight) break;
+		if (FPlatformTime::Seconds() - StartTime > BudgetSeconds) break;
+
+		FBatch Batch = PendingBatches.FindAndRemoveChecked(Key);
+
+		// A batch for the same cells may have started since this one was queued
+		if (FBatch* Running = InFlightBatches.Find(Key))
+		{
+			Running->Requests.Append(MoveTemp(Batch.Requests));
+			continue;
+		}
+
+		if (DispatchBatch(Key, Batch))
+		{
+			InFlightBatches.Add(Key, MoveTemp(Batch));
+			Stats.DispatchedLastFrame++;
+		}
+		else
+		{
+			for (FRequest& Request : Batch.Requests)
+			{
+				Request.Callback.ExecuteIfBound(Request.RequestId, false, nullptr);
+			}
+		}
+	}
+}
+
+bool UEnemyPathBroker::DispatchBatch(uint64 Key, FBatch& Batch)
+{
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys) return false;
+
+	// Any live requester can stand in for the whole batch
+	AEnemyAIController* Querier = nullptr;
+	for (const FRequest& Request : Batch.Requests)
+	{
+		if (AEnemyAIController* Requester = Request.Requester.Get())
+		{
+			Querier = Requester;
+			break;
+		}
+	}
+	if (!Querier) return false;
+
+	const FNavAgentProperties& AgentProps = Querier->GetNavAgentPropertiesRef();
+	const ANavigationData* NavData = NavSys->GetNavDataForProps(AgentProps, Batch.Start);
+	if (!NavData) return false;
+
+	FSharedConstNavQueryFilter Filter = UNavigationQueryFilter::GetQueryFilter(*NavData, Querier, Querier->GetDefaultNavigationFilterClass());
+	FPathFindingQuery Query(Querier, *NavData, Batch.Start, Batch.Goal, Filter);
+
+	Batch.QueryId = NavSys->FindPathAsync(AgentProps, Query, FNavPathQueryDelegate::CreateUObject(this, &UEnemyPathBroker::OnPathFound));
+	if (Batch.QueryId == INVALID_NAVQUERYID) return false;
+
+	QueryToBatch.Add(Batch.QueryId, Key);
+	return true;
+}
+
+void UEnemyPathBroker::OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+	uint64 Key;
+	if (!QueryToBatch.RemoveAndCopyValue(QueryId, Key)) return;
+
+	FBatch Batch;
+	if (!InFlightBatches.RemoveAndCopyValue(Key, Batch)) return;
+
+	const bool bSuccess = Result == ENavigationQueryResult::Success && Path.IsValid();
+	const double Now = FPlatformTime::Seconds();
+
+	bool bFirst = true;
+	for (FRequest& Request : Batch.Requests)
+	{
+		const float LatencyMs = static_cast<float>((Now - Request.QueuedTime) * 1000.0);
+		Stats.AverageLatencyMs = FMath::Lerp(Stats.AverageLatencyMs, LatencyMs, 0.1f);
+		Stats.MaxLatencyMs = FMath::Max(Stats.MaxLatencyMs, LatencyMs);
+
+		if (!Request.Requester.IsValid()) continue;
+
+		FNavPathSharedPtr RequestPath = nullptr;
+		if (bSuccess)
+		{
+			RequestPath = bFirst ? Path : ClonePathForRequest(Path, Request.Start);
+			bFirst = false;
+		}
+
+		Request.Callback.ExecuteIfBound(Request.RequestId, bSuccess, RequestPath);
+	}
+}
+
+FNavPathSharedPtr UEnemyPathBroker::ClonePathForRequest(const FNavPathSharedPtr& Path, const FVector& Start)
+{
+	const FNavMeshPath* SourcePath = Path->CastPath<FNavMeshPath>();
+	if (!SourcePath) return Path;
+
+	TSharedPtr<FNavMeshPath, ESPMode::ThreadSafe> NewPath = MakeShared<FNavMeshPath, ESPMode::ThreadSafe>();
+	NewPath->GetPathPoints() = SourcePath->GetPathPoints();
+	NewPath->PathCorridor = SourcePath->PathCorridor;
+	NewPath->PathCorridorCost = SourcePath->PathCorridorCost;
+	NewPath->SetNavigationDataUsed(SourcePath->GetNavigationDataUsed());
+	NewPath->SetQuerier(SourcePath->GetQuerier());
+
+	// Same start cell, but not the same start point
+	if (NewPath->GetPathPoints().Num() > 0)
+	{
+		NewPath->GetPathPoints()[0].Location = Start;
+	}
+
+	NewPath->MarkReady();
+	return NewPath;
+}
+
+FEnemyPathBrokerStats UEnemyPathBroker::GetStats() const
+{
+	FEnemyPathBrokerStats Result = Stats;
+
+	Result.QueueDepth = 0;
+	for (const TPair<uint64, FBatch>& Pair : PendingBatches)
+	{
+		Result.QueueDepth += Pair.Value.Requests.Num();
+	}
+	Result.InFlight = InFlightBatches.Num();
+
+	return Result;
+}
+
+void UEnemyPathBroker::SetMaxDispatchPerFrame(int32 NewMax)
+{
+	MaxDispatchPerFrame = FMath::Max(1, NewMax);
+}
+
+void UEnemyPathBroker::SetDispatchBudgetMs(float NewBudget)
+{
+	DispatchBudgetMs = NewBudget;
+}
@@ -0,0 +1,64 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/EnemyPathFollowingComponent.h"
+
+#include "AIController.h"
+#include "GameFramework/PawnMovementComponent.h"
+
+void UEnemyPathFollowingComponent::SetUseSpatialHashSteering(bool bEnable)
+{
+	bUseSpatialHashSteering = bEnable;
+	bHasSteering = false;
+
+	// Detour and the spatial hash must never steer the same agent
+	SetCrowdSimulationState(bEnable ? ECrowdSimulationState::Disabled : ECrowdSimulationState::Enabled);
+}
+
+void UEnemyPathFollowingComponent::SetSteeringDirection(const FVector2D& Direction)
+{
+	SteeringDirection = Direction;
+	bHasSteering = true;
+}
+
+bool UEnemyPathFollowingComponent::GetSteeringGoal(FVector& OutGoal) const
+{
+	if (GetStatus() != EPathFollowingStatus::Moving) return false;
+
+	OutGoal = GetCurrentTargetLocation();
+	return true;
+}
+
+APawn* UEnemyPathFollowingComponent::GetControlledPawn() const
+{
+	const AAIController* AIOwner = Cast<AAIController>(GetOwner());
+	return AIOwner ? AIOwner->GetPawn() : nullptr;
+}
+
+void UEnemyPathFollowingComponent::FollowPathSegment(float DeltaTime)
+{
+	if (!bUseSpatialHashSteering || !bHasSteering)
+	{
+		Super::FollowPathSegment(DeltaTime);
+		return;
+	}
+
+	APawn* Pawn = GetControlledPawn();
+	UPawnMovementComponent* MoveComp = Pawn ? Pawn->GetMovementComponent() : nullptr;
+	if (!MoveComp)
+	{
+		Super::FollowPathSegment(DeltaTime);
+		return;
+	}
+
+	const FVector MoveVelocity = FVector(SteeringDirection, 0.0f) * MoveComp->GetMaxSpeed();
+	MoveComp->RequestDirectMove(MoveVelocity, false);
+}
+
+void UEnemyPathFollowingComponent::OnPathFinished(const FPathFollowingResult& Result)
+{
+	// Drop the stale direction so the next move starts from plain path following
+	bHasSteering = false;
+
+	Super::OnPathFinished(Result);
+}
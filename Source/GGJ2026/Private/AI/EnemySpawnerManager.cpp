@@ -3,7 +3,11 @@
 
 #include "AI/EnemySpawnerManager.h"
 
+#include "AI/EnemyArchetypeRegistry.h"
+#include "Camera/CameraVisibilitySubsystem.h"
+#include "Debug/FlightRecorder.h"
 #include "Game/EnemySpawner.h"
+#include "Game/GGJStats.h"
 #include "Kismet/GameplayStatics.h"
 
 void UEnemySpawnerManager::Initialize(FSubsystemCollectionBase& Collection)
@@ -12,8 +16,25 @@ void UEnemySpawnerManager::Initialize(FSubsystemCollectionBase& Collection)
 	
 	ActiveEnemies.Reserve(MaxEnemies);
 	EnemyPool.Empty();
-	EnemyTypeList.Empty();
+	PooledEnemies.Empty();
+	ArchetypeList.Empty();
 	EnemySpawners.Empty();
+	
+	// -GGJSeed=<n> repeats the spawn flow of an earlier run
+	int32 Seed = static_cast<int32>(FPlatformTime::Cycles());
+	FParse::Value(FCommandLine::Get(), TEXT("GGJSeed="), Seed);
+	SetRandomSeed(Seed);
+}
+
+void UEnemySpawnerManager::SetRandomSeed(int32 Seed)
+{
+	Random.Initialize(Seed);
+}
+
+int32 UEnemySpawnerManager::GetSpawnerSeed(const AActor* Spawner) const
+{
+	// String hash, FName hashes differ between processes
+	return static_cast<int32>(HashCombine(static_cast<uint32>(GetRandomSeed()), GetTypeHash(Spawner->GetName())));
 }
 
 void UEnemySpawnerManager::SetMaxEnemies(int32 NewMax)
@@ -43,25 +64,32 @@ void UEnemySpawnerManager::AddEnemyToPool(AEnemyCharacter* Enemy)
 	if (Enemy)
 	{
 		EnemyPool.Enqueue(Enemy);
+		PooledEnemies.Add(Enemy);
+		GGJ_SET_GAUGE(EnemyPoolSize, GetNumPooled());
 	}
 	
 }
 
+int32 UEnemySpawnerManager::GetNumPooled() const
+{
+	int32 NumPooled = 0;
+	for (const TWeakObjectPtr<AEnemyCharacter>& Enemy : PooledEnemies)
+	{
+		if (Enemy.IsValid() && !Enemy->IsActorBeingDestroyed() && !ActiveEnemies.Contains(Enemy.Get())) ++NumPooled;
+	}
+	return NumPooled;
+}
+
 void UEnemySpawnerManager::InitSpawn()
 {
+	LLM_SCOPE_BYTAG(GGJ_Enemies);
+	
+	// Never filled, so nothing is pooled here. Left as is: SpawnEnemy does not take enemies from the pool,
+	// filling it would only leave MaxEnemies idle enemies standing at the spawners.
 	TArray<AActor*> Spawners;
 	TArray<AEnemyCharacter*> Enemies;
-	TArray<EEnemyType> TypeList;
-	
-	int32 CountType0 = FMath::RoundToInt(MaxEnemies * 0.40f);
-	int32 CountType1 = FMath::RoundToInt(MaxEnemies * 0.20f);
-	int32 CountType2 = FMath::RoundToInt(MaxEnemies * 0.20f);
-    int32 CountType3 = MaxEnemies - (CountType0 + CountType1 + CountType2);
-	
-	for (int32 i = 0; i < CountType0; i++) TypeList.Add(EEnemyType::None);
-	for (int32 i = 0; i < CountType1; i++) TypeList.Add(EEnemyType::RedRabbit);
-	for (int32 i = 0; i < CountType2; i++) TypeList.Add(EEnemyType::GreenBird);
-	for (int32 i = 0; i < CountType3; i++) TypeList.Add(EEnemyType::BlueCat);
+	TArray<int32> TypeList;
+	BuildArchetypeList(TypeList);
 	
 	int32 CurrentTypeIndex = 0;
 
@@ -79,36 +107,50 @@ void UEnemySpawnerManager::InitSpawn()
 				AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(GetWorld()->SpawnActor(EnemyClass));
 				Enemy->SpawnLocation = Cast<AEnemySpawner>(Spawners[i])->GetSpawnLocation();
 				Enemy->SetActorLocation(Enemy->SpawnLocation);
-				Enemy->Type = TypeList[CurrentTypeIndex++];
+				Enemy->SetArchetypeIndex(TypeList[CurrentTypeIndex++]);
 				Enemies.Add(Enemy);				
 			}
 		}
 		
-		int32 LastIndex = Enemies.Num() - 1;
-		for (int32 i = 0; i <= LastIndex; ++i)
-		{
-			int32 Index = FMath::RandRange(i, LastIndex);
-			if (i != Index) Enemies.Swap(i, Index);
-		}
+		ShuffleList(Enemies, Random);
 
 		for (AEnemyCharacter* Enemy : Enemies)
 		{
 			EnemyPool.Enqueue(Enemy);
+			PooledEnemies.Add(Enemy);
 		}
+		
+		GGJ_SET_GAUGE(EnemyPoolSize, GetNumPooled());
 	}
 }
 
+void UEnemySpawnerManager::BuildArchetypeList(TArray<int32>& OutList) const
+{
+	BuildArchetypeList(MaxEnemies, UEnemyArchetypeRegistry::Get(this), OutList);
+}
+
+void UEnemySpawnerManager::BuildArchetypeList(int32 Count, const UEnemyArchetypeRegistry* Registry, TArray<int32>& OutList)
+{
+	auto IndexOf = [Registry](EEnemyType Type) { return Registry ? FMath::Max(Registry->FindArchetypeIndex(Type), 0) : 0; };
+	
+	int32 CountType0 = FMath::RoundToInt(Count * 0.40f);
+	int32 CountType1 = FMath::RoundToInt(Count * 0.20f);
+	int32 CountType2 = FMath::RoundToInt(Count * 0.20f);
+	int32 CountType3 = Count - (CountType0 + CountType1 + CountType2);
+	
+	OutList.Reserve(OutList.Num() + Count);
+	for (int32 i = 0; i < CountType0; i++) OutList.Add(IndexOf(EEnemyType::None));
+	for (int32 i = 0; i < CountType1; i++) OutList.Add(IndexOf(EEnemyType::RedRabbit));
+	for (int32 i = 0; i < CountType2; i++) OutList.Add(IndexOf(EEnemyType::GreenBird));
+	for (int32 i = 0; i < CountType3; i++) OutList.Add(IndexOf(EEnemyType::BlueCat));
+}
+
 void UEnemySpawnerManager::SetSpawnTimer()
 {	
-	int32 CountType0 = FMath::RoundToInt(MaxEnemies * 0.40f);
-	int32 CountType1 = FMath::RoundToInt(MaxEnemies * 0.20f);
-	int32 CountType2 = FMath::RoundToInt(MaxEnemies * 0.20f);
-	int32 CountType3 = MaxEnemies - (CountType0 + CountType1 + CountType2);
-	
-	for (int32 i = 0; i < CountType0; i++) EnemyTypeList.Add(EEnemyType::None);
-	for (int32 i = 0; i < CountType1; i++) EnemyTypeList.Add(EEnemyType::RedRabbit);
-	for (int32 i = 0; i < CountType2; i++) EnemyTypeList.Add(EEnemyType::GreenBird);
-	for (int32 i = 0; i < CountType3; i++) EnemyTypeList.Add(EEnemyType::BlueCat);
+	// Rebuilt for the current MaxEnemies, the timer can be restarted with new settings
+	ArchetypeList.Reset();
+	BuildArchetypeList(ArchetypeList);
+	TypeIdx = 0;
 	
 	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AEnemySpawner::StaticClass(), EnemySpawners);
 	GetWorld()->GetTimerManager().SetTimer(SpawnTimer, this, &UEnemySpawnerManager::SpawnEnemy, SpawnRate, true);
@@ -119,8 +161,17 @@ void UEnemySpawnerManager::ClearSpawnTimer()
 	GetWorld()->GetTimerManager().ClearTimer(SpawnTimer);
 }
 
+float UEnemySpawnerManager::GetTimeUntilNextSpawn() const
+{
+	return GetWorld()->GetTimerManager().GetTimerRemaining(SpawnTimer);
+}
+
 void UEnemySpawnerManager::SpawnEnemy()
 {
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJSpawnEnemy, Spawn);
+	LLM_SCOPE_BYTAG(GGJ_Enemies);
+	GGJ_FLIGHT_TIMER(SpawnEnemy);
+	
 	/* if (!EnemyPool.IsEmpty())
 	{
 		AEnemyCharacter* CurrentEnemy;
@@ -133,19 +184,53 @@ void UEnemySpawnerManager::SpawnEnemy()
 		AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(GetWorld()->SpawnActor(EnemyClass));
 		if (Enemy)
 		{
-			Enemy->SpawnLocation = Cast<AEnemySpawner>(EnemySpawners[FMath::RandRange(0, EnemySpawners.Num()-1)])->GetSpawnLocation();
+			Enemy->SpawnLocation = Cast<AEnemySpawner>(ChooseSpawner())->GetSpawnLocation();
 			Enemy->SetActorLocation(Enemy->SpawnLocation);
-			if (TypeIdx == MaxEnemies)
+			if (TypeIdx >= ArchetypeList.Num())
 			{
 				TypeIdx = 0;
 			}
-			Enemy->Type = EnemyTypeList[TypeIdx++];
+			Enemy->SetArchetypeIndex(ArchetypeList[TypeIdx++]);
 			Enemy->ActivateEnemy();
 			ActiveEnemies.Add(Enemy);
+			NumSpawned++;
+			GGJ_SET_GAUGE(ActiveEnemies, ActiveEnemies.Num());
 		}	
 	}
 }
 
+AActor* UEnemySpawnerManager::ChooseSpawner() const
+{
+	const UCameraVisibilitySubsystem* Visibility = GetWorld()->GetSubsystem<UCameraVisibilitySubsystem>();
+	if (!Visibility || !Visibility->HasView()) return EnemySpawners[Random.RandRange(0, EnemySpawners.Num()-1)];
+	
+	TArray<FVector, TInlineAllocator<16>> Locations;
+	for (const AActor* Spawner : EnemySpawners)
+	{
+		Locations.Add(Spawner->GetActorLocation());
+	}
+	
+	TArray<float, TInlineAllocator<16>> Distances;
+	Distances.SetNumUninitialized(Locations.Num());
+	Visibility->GetDistancesOutsideView(Locations, Distances);
+	
+	// Random among the spawners just off-screen, otherwise the closest off-screen one
+	TArray<int32, TInlineAllocator<16>> Candidates;
+	int32 ClosestIndex = INDEX_NONE;
+	for (int32 i = 0; i < Distances.Num(); ++i)
+	{
+		if (Distances[i] <= 0.0f) continue;
+		
+		if (Distances[i] <= MaxSpawnDistanceOutsideView) Candidates.Add(i);
+		if (ClosestIndex == INDEX_NONE || Distances[i] < Distances[ClosestIndex]) ClosestIndex = i;
+	}
+	
+	if (Candidates.Num() > 0) return EnemySpawners[Candidates[Random.RandRange(0, Candidates.Num()-1)]];
+	if (ClosestIndex != INDEX_NONE) return EnemySpawners[ClosestIndex];
+	
+	return EnemySpawners[Random.RandRange(0, EnemySpawners.Num()-1)];
+}
+
 void UEnemySpawnerManager::ResetEnemy(AEnemyCharacter* Enemy)
 {
 	if (Enemy)
@@ -153,8 +238,10 @@ void UEnemySpawnerManager::ResetEnemy(AEnemyCharacter* Enemy)
 		ActiveEnemies.Remove(Enemy);
 		ActiveEnemies.Compact();
 		ActiveEnemies.Shrink();
+		GGJ_SET_GAUGE(ActiveEnemies, ActiveEnemies.Num());
 		// Enemy->DeactivateEnemy();
 		Enemy->Destroy();
+		GGJ_SET_GAUGE(EnemyPoolSize, GetNumPooled());
 		// EnemyPool.Enqueue(Enemy);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,178 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/EnemySteeringSubsystem.h"
+
+#include "AI/EnemyPathFollowingComponent.h"
+#include "Async/ParallelFor.h"
+#include "Game/GGJStats.h"
+
+void UEnemySteeringSubsystem::Deinitialize()
+{
+	Agents.Empty();
+	ActiveAgents.Empty();
+	CellRanges.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemySteeringSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemySteeringSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemySteeringSubsystem::RegisterAgent(UEnemyPathFollowingComponent* Agent)
+{
+	if (Agent)
+	{
+		Agents.AddUnique(Agent);
+	}
+}
+
+void UEnemySteeringSubsystem::UnregisterAgent(UEnemyPathFollowingComponent* Agent)
+{
+	Agents.RemoveSwap(Agent);
+}
+
+void UEnemySteeringSubsystem::SetSeparationRadius(float NewRadius)
+{
+	SeparationRadius = NewRadius;
+	CellSize = FMath::Max(CellSize, SeparationRadius);
+}
+
+void UEnemySteeringSubsystem::SetCohesionRadius(float NewRadius)
+{
+	CohesionRadius = NewRadius;
+	CellSize = FMath::Max(CellSize, CohesionRadius);
+}
+
+FIntPoint UEnemySteeringSubsystem::GetCell(const FVector2D& Position) const
+{
+	return FIntPoint(FMath::FloorToInt32(Position.X / CellSize), FMath::FloorToInt32(Position.Y / CellSize));
+}
+
+void UEnemySteeringSubsystem::Tick(float DeltaTime)
+{
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJSteering, AI);
+	LLM_SCOPE_BYTAG(GGJ_AI);
+
+	if (Agents.Num() == 0) return;
+
+	// --- Gather (Game Thread) ---
+	ActiveAgents.Reset();
+	Positions.Reset();
+	Goals.Reset();
+	HasGoal.Reset();
+
+	for (UEnemyPathFollowingComponent* Agent : Agents)
+	{
+		const APawn* Pawn = Agent ? Agent->GetControlledPawn() : nullptr;
+		if (!Pawn) continue;
+
+		FVector Goal = FVector::ZeroVector;
+		const bool bHasGoal = Agent->GetSteeringGoal(Goal);
+
+		ActiveAgents.Add(Agent);
+		Positions.Add(FVector2D(Pawn->GetActorLocation()));
+		Goals.Add(FVector2D(Goal));
+		HasGoal.Add(bHasGoal);
+	}
+
+	const int32 NumAgents = ActiveAgents.Num();
+	if (NumAgents == 0) return;
+
+	// --- Build Grid ---
+	SortedIndices.Reset(NumAgents);
+	for (int32 i = 0; i < NumAgents; ++i) SortedIndices.Add(i);
+
+	TArray<FIntPoint> Cells;
+	Cells.SetNumUninitialized(NumAgents);
+	for (int32 i = 0; i < NumAgents; ++i) Cells[i] = GetCell(Positions[i]);
+
+	SortedIndices.Sort([&Cells](int32 A, int32 B)
+	{
+		return Cells[A].X != Cells[B].X ? Cells[A].X < Cells[B].X : Cells[A].Y < Cells[B].Y;
+	});
+
+	CellRanges.Reset();
+	for (int32 i = 0; i < NumAgents; ++i)
+	{
+		FIntPoint& Range = CellRanges.FindOrAdd(Cells[SortedIndices[i]], FIntPoint(i, 0));
+		Range.Y++;
+	}
+
+	// --- Steering (Parallel, read-only) ---
+	Results.SetNumUninitialized(NumAgents);
+	ParallelFor(NumAgents, [this](int32 Index)
+	{
+		Results[Index] = ComputeSteering(Index);
+	}, NumAgents < 32 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// --- Apply (Game Thread) ---
+	for (int32 i = 0; i < NumAgents; ++i)
+	{
+		ActiveAgents[i]->SetSteeringDirection(Results[i]);
+	}
+}
+
+FVector2D UEnemySteeringSubsystem::ComputeSteering(int32 AgentIndex) const
+{
+	const FVector2D Position = Positions[AgentIndex];
+	const FIntPoint Cell = GetCell(Position);
+
+	const float SeparationRadiusSq = SeparationRadius * SeparationRadius;
+	const float CohesionRadiusSq = CohesionRadius * CohesionRadius;
+
+	FVector2D Separation = FVector2D::ZeroVector;
+	FVector2D NeighbourSum = FVector2D::ZeroVector;
+	int32 NeighbourCount = 0;
+
+	// Only the 3x3 block around our cell can contain agents within range
+	for (int32 OffsetX = -1; OffsetX <= 1; ++OffsetX)
+	{
+		for (int32 OffsetY = -1; OffsetY <= 1; ++OffsetY)
+		{
+			const FIntPoint* Range = CellRanges.Find(FIntPoint(Cell.X + OffsetX, Cell.Y + OffsetY));
+			if (!Range) continue;
+
+			for (int32 i = Range->X; i < Range->X + Range->Y; ++i)
+			{
+				const int32 Other = SortedIndices[i];
+				if (Other == AgentIndex) continue;
+
+				const FVector2D ToSelf = Position - Positions[Other];
+				const float DistSq = ToSelf.SizeSquared();
+
+				if (DistSq < SeparationRadiusSq && DistSq > KINDA_SMALL_NUMBER)
+				{
+					// Stronger push the closer the neighbour is
+					const float Dist = FMath::Sqrt(DistSq);
+					Separation += (ToSelf / Dist) * (1.0f - Dist / SeparationRadius);
+				}
+
+				if (DistSq < CohesionRadiusSq)
+				{
+					NeighbourSum += Positions[Other];
+					NeighbourCount++;
+				}
+			}
+		}
+	}
+
+	FVector2D Steering = FVector2D::ZeroVector;
+
+	if (HasGoal[AgentIndex])
+	{
+		Steering += (Goals[AgentIndex] - Position).GetSafeNormal() * GoalWeight;
+	}
+
+	Steering += Separation * SeparationWeight;
+
+	if (NeighbourCount > 0)
+	{
+		const FVector2D Centroid = NeighbourSum / NeighbourCount;
+		Steering += (Centroid - Position).GetSafeNormal() * CohesionWeight;
+	}
+
+	return Steering.GetClampedToMaxSize(1.0f);
+}
@@ -0,0 +1,108 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Animation/CombatAnimNotifies.h"
+
+#include "PaperZDAnimInstance.h"
+#include "Characters/EnemyCharacter.h"
+#include "Characters/GGJCharacter.h"
+#include "Game/GameplayFramePipeline.h"
+
+namespace
+{
+	/** Enemies batch their notifies through the frame pipeline. Falls back to applying now if there is none. */
+	bool TryQueueEnemyNotify(AEnemyCharacter* Enemy, ECombatNotifyType Type, FName SocketName = NAME_None, const FVector& Extent = FVector::ZeroVector)
+	{
+		UGameplayFramePipeline* Pipeline = Enemy->GetWorld()->GetSubsystem<UGameplayFramePipeline>();
+		if (!Pipeline) return false;
+
+		Pipeline->QueueEnemyNotify(Enemy, Type, SocketName, Extent);
+		return true;
+	}
+}
+
+void UGGJAnimNotify_ActivateHitbox::OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance) const
+{
+	AActor* Owner = OwningInstance ? OwningInstance->GetOwningActor() : nullptr;
+
+	if (AGGJCharacter* Player = Cast<AGGJCharacter>(Owner))
+	{
+		Player->ActivateMeleeHitbox(SocketName, Extent, DamageIndex);
+	}
+	else if (AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(Owner))
+	{
+		if (!TryQueueEnemyNotify(Enemy, ECombatNotifyType::ActivateHitbox, SocketName, Extent))
+		{
+			Enemy->ActivateMeleeHitbox(SocketName, Extent);
+		}
+	}
+}
+
+void UGGJAnimNotify_DeactivateHitbox::OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance) const
+{
+	AActor* Owner = OwningInstance ? OwningInstance->GetOwningActor() : nullptr;
+
+	if (AGGJCharacter* Player = Cast<AGGJCharacter>(Owner))
+	{
+		Player->DeactivateMeleeHitbox();
+	}
+	else if (AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(Owner))
+	{
+		if (!TryQueueEnemyNotify(Enemy, ECombatNotifyType::DeactivateHitbox))
+		{
+			Enemy->DeactivateMeleeHitbox();
+		}
+	}
+}
+
+void UGGJAnimNotify_AttackFinished::OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance) const
+{
+	AActor* Owner = OwningInstance ? OwningInstance->GetOwningActor() : nullptr;
+
+	if (AGGJCharacter* Player = Cast<AGGJCharacter>(Owner))
+	{
+		Player->OnAttackFinished();
+	}
+	else if (AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(Owner))
+	{
+		if (!TryQueueEnemyNotify(Enemy, ECombatNotifyType::AttackFinished))
+		{
+			Enemy->AttackFinished();
+		}
+	}
+}
+
+void UGGJAnimNotify_RollFinished::OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance) const
+{
+	if (AGGJCharacter* Player = Cast<AGGJCharacter>(OwningInstance ? OwningInstance->GetOwningActor() : nullptr))
+	{
+		Player->OnRollFinished();
+	}
+}
+
+void UGGJAnimNotify_GetUpFinished::OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance) const
+{
+	if (AGGJCharacter* Player = Cast<AGGJCharacter>(OwningInstance ? OwningInstance->GetOwningActor() : nullptr))
+	{
+		Player->OnGetUpFinished();
+	}
+}
+
+void UGGJAnimNotify_EnemyDeath::OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance) const
+{
+	if (AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(OwningInstance ? OwningInstance->GetOwningActor() : nullptr))
+	{
+		if (!TryQueueEnemyNotify(Enemy, ECombatNotifyType::Death))
+		{
+			Enemy->FinishDeath();
+		}
+	}
+}
+
+void UGGJAnimNotify_UpdateMaskSocket::OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance) const
+{
+	if (AGGJCharacter* Player = Cast<AGGJCharacter>(OwningInstance ? OwningInstance->GetOwningActor() : nullptr))
+	{
+		Player->ActivateMask(SocketName);
+	}
+}
@@ -0,0 +1,209 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Animation/EnemyAnimBudgetSubsystem.h"
+
+#include "PaperFlipbookComponent.h"
+#include "PaperZDAnimationComponent.h"
+#include "PaperZDAnimInstance.h"
+#include "Camera/CameraVisibilitySubsystem.h"
+#include "Characters/EnemyCharacter.h"
+
+void UEnemyAnimBudgetSubsystem::Deinitialize()
+{
+	Enemies.Empty();
+	States.Empty();
+	Candidates.Empty();
+	GroupLeaders.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyAnimBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyAnimBudgetSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyAnimBudgetSubsystem::RegisterEnemy(AEnemyCharacter* Enemy)
+{
+	if (!Enemy || Enemies.Contains(Enemy)) return;
+
+	// From now on the budget decides when the anim instance ticks
+	if (UPaperZDAnimationComponent* AnimComp = Enemy->GetAnimationComponent())
+	{
+		AnimComp->SetComponentTickEnabled(false);
+	}
+
+	Enemies.Add(Enemy);
+	States.AddDefaulted();
+}
+
+void UEnemyAnimBudgetSubsystem::UnregisterEnemy(AEnemyCharacter* Enemy)
+{
+	const int32 Index = Enemies.Find(Enemy);
+	if (Index == INDEX_NONE) return;
+
+	SetFrozen(Index, false);
+
+	if (UPaperZDAnimationComponent* AnimComp = Enemy->GetAnimationComponent())
+	{
+		AnimComp->SetComponentTickEnabled(true);
+	}
+
+	Enemies.RemoveAtSwap(Index);
+	States.RemoveAtSwap(Index);
+}
+
+void UEnemyAnimBudgetSubsystem::SetMaxEvaluationsPerFrame(int32 NewMax)
+{
+	MaxEvaluationsPerFrame = FMath::Max(0, NewMax);
+}
+
+bool UEnemyAnimBudgetSubsystem::IsOnScreen(const AEnemyCharacter* Enemy) const
+{
+	// Nothing is rendered without a view, freezing everything would hide the real cost from headless benchmarks
+	const UCameraVisibilitySubsystem* Visibility = GetWorld()->GetSubsystem<UCameraVisibilitySubsystem>();
+	if (!Visibility || !Visibility->HasView()) return true;
+
+	return Visibility->IsOnScreen(Enemy->GetActorLocation(), OffScreenMargin);
+}
+
+void UEnemyAnimBudgetSubsystem::SetFrozen(int32 Index, bool bFreeze)
+{
+	FAgentState& State = States[Index];
+	if (State.bFrozen == bFreeze) return;
+
+	State.bFrozen = bFreeze;
+	State.AccumulatedTime = 0.0f;
+
+	if (AEnemyCharacter* Enemy = Enemies[Index])
+	{
+		Enemy->GetSprite()->SetComponentTickEnabled(!bFreeze);
+	}
+}
+
+uint32 UEnemyAnimBudgetSubsystem::GetAnimStateKey(const AEnemyCharacter* Enemy)
+{
+	// Front, back or side, the same sectors the directional flipbooks are split into
+	const float Direction = FMath::Abs(Enemy->AnimDirection);
+	const uint32 Sector = Direction < 45.0f ? 0 : (Direction > 135.0f ? 1 : 2);
+	const uint32 bMoving = Enemy->GetVelocity().SizeSquared2D() > 1.0f ? 1 : 0;
+
+	// Locomotion, hit reaction, attack or death, the states that play different flipbooks
+	const uint32 State = Enemy->IsDead() ? 3 : (Enemy->IsAttacking ? 2 : (Enemy->IsHitReacting() ? 1 : 0));
+
+	return static_cast<uint32>(Enemy->GetArchetypeIndex()) << 5 | State << 3 | Sector << 1 | bMoving;
+}
+
+void UEnemyAnimBudgetSubsystem::CopyLeaderFrame(int32 LeaderIndex, int32 FollowerIndex) const
+{
+	const UPaperFlipbookComponent* Leader = Enemies[LeaderIndex]->GetSprite();
+	UPaperFlipbookComponent* Follower = Enemies[FollowerIndex]->GetSprite();
+
+	if (Follower->GetFlipbook() != Leader->GetFlipbook())
+	{
+		Follower->SetFlipbook(Leader->GetFlipbook());
+	}
+	Follower->SetPlaybackPosition(Leader->GetPlaybackPosition(), false);
+}
+
+bool UEnemyAnimBudgetSubsystem::IsFrozen(const AEnemyCharacter* Enemy) const
+{
+	const int32 Index = Enemies.Find(const_cast<AEnemyCharacter*>(Enemy));
+	return Index != INDEX_NONE && States[Index].bFrozen;
+}
+
+void UEnemyAnimBudgetSubsystem::Evaluate(int32 Index)
+{
+	FAgentState& State = States[Index];
+
+	if (UPaperZDAnimationComponent* AnimComp = Enemies[Index]->GetAnimationComponent())
+	{
+		if (UPaperZDAnimInstance* AnimInstance = AnimComp->GetAnimInstance())
+		{
+			// One step with all the time this instance missed, so notifies in between still fire
+			AnimInstance->Tick(State.AccumulatedTime);
+		}
+	}
+
+	State.AccumulatedTime = 0.0f;
+	Stats.Evaluated++;
+}
+
+void UEnemyAnimBudgetSubsystem::Tick(float DeltaTime)
+{
+	Stats = FEnemyAnimBudgetStats();
+	Stats.Registered = Enemies.Num();
+
+	Candidates.Reset();
+	GroupLeaders.Reset();
+
+	// --- Freeze / Forced ---
+	for (int32 i = 0; i < Enemies.Num(); ++i)
+	{
+		AEnemyCharacter* Enemy = Enemies[i];
+		if (!IsValid(Enemy)) continue;
+
+		// Attacks and deaths keep animating off-screen, their notifies release the attack token and remove the enemy
+		const bool bFullRate = Enemy->IsAttacking || Enemy->IsDead();
+		if (!bFullRate && !IsOnScreen(Enemy))
+		{
+			SetFrozen(i, true);
+			Stats.Frozen++;
+			continue;
+		}
+
+		SetFrozen(i, false);
+
+		FAgentState& State = States[i];
+		State.AccumulatedTime += DeltaTime;
+
+		if (bFullRate || State.AccumulatedTime >= MaxAccumulatedTime)
+		{
+			// Attacks and deaths are one-off playbacks, nobody should copy them
+			if (!bFullRate) GroupLeaders.FindOrAdd(GetAnimStateKey(Enemy), i);
+			Evaluate(i);
+			continue;
+		}
+
+		Candidates.Add(i);
+	}
+
+	// Longest waiting first, which round-robins the budget over time
+	Candidates.Sort([this](int32 A, int32 B)
+	{
+		return States[A].AccumulatedTime > States[B].AccumulatedTime;
+	});
+
+	int32 Budget = MaxEvaluationsPerFrame;
+
+	// --- Group Leaders ---
+	for (const int32 Index : Candidates)
+	{
+		if (Budget <= 0) break;
+
+		const uint32 Key = GetAnimStateKey(Enemies[Index]);
+		if (GroupLeaders.Contains(Key)) continue;
+
+		GroupLeaders.Add(Key, Index);
+		Evaluate(Index);
+		Budget--;
+	}
+
+	// --- Followers ---
+	for (const int32 Index : Candidates)
+	{
+		if (States[Index].AccumulatedTime <= 0.0f) continue;
+
+		if (Budget > 0)
+		{
+			Evaluate(Index);
+			Budget--;
+		}
+		else if (const int32* Leader = GroupLeaders.Find(GetAnimStateKey(Enemies[Index])))
+		{
+			CopyLeaderFrame(*Leader, Index);
+			Stats.Shared++;
+		}
+	}
+}
@@ -0,0 +1,124 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Camera/CameraFraming.h"
+
+bool FCameraFraming::ComputeFraming(TArrayView<const FVector> Points, FVector& OutCenter, float& OutSpread)
+{
+	if (Points.Num() == 0) return false;
+
+	FVector SumLocation = FVector::ZeroVector;
+	float MaxSpreadSq = 0.0f;
+
+	for (int32 i = 0; i < Points.Num(); ++i)
+	{
+		SumLocation += Points[i];
+
+		// Each pair once
+		for (int32 j = i + 1; j < Points.Num(); ++j)
+		{
+			MaxSpreadSq = FMath::Max(MaxSpreadSq, FVector::DistSquared(Points[i], Points[j]));
+		}
+	}
+
+	OutCenter = SumLocation / Points.Num();
+	OutSpread = FMath::Sqrt(MaxSpreadSq);
+	return true;
+}
+
+FCameraFraming::FViewRays FCameraFraming::ComputeViewRays(const FVector& ViewLocation, const FRotator& ViewRotation, float HorizontalFOV, const FVector2D& ViewportSize, float EdgePadding)
+{
+	FViewRays Rays;
+	Rays.Origin = ViewLocation;
+
+	if (ViewportSize.X <= 0.0f || ViewportSize.Y <= 0.0f) return Rays;
+
+	// Half extents of the image plane at distance 1. The horizontal FOV is kept, the vertical follows the aspect ratio.
+	const float TanHalfX = FMath::Tan(FMath::DegreesToRadians(HorizontalFOV * 0.5f));
+	const float TanHalfY = TanHalfX * ViewportSize.Y / ViewportSize.X;
+
+	// Padding in pixels as a fraction of the half screen
+	const float NdcX = FMath::Max(0.0f, 1.0f - 2.0f * EdgePadding / ViewportSize.X);
+	const float NdcY = FMath::Max(0.0f, 1.0f - 2.0f * EdgePadding / ViewportSize.Y);
+
+	const FRotationMatrix Rotation(ViewRotation);
+	const FVector Forward = Rotation.GetUnitAxis(EAxis::X);
+	const FVector Right = Rotation.GetUnitAxis(EAxis::Y) * (TanHalfX * NdcX);
+	const FVector Up = Rotation.GetUnitAxis(EAxis::Z) * (TanHalfY * NdcY);
+
+	Rays.Directions[0] = Forward - Right + Up;
+	Rays.Directions[1] = Forward + Right + Up;
+	Rays.Directions[2] = Forward + Right - Up;
+	Rays.Directions[3] = Forward - Right - Up;
+	Rays.bValid = true;
+
+	return Rays;
+}
+
+bool FCameraFraming::GetPlaneQuad(const FViewRays& Rays, float PlaneZ, FVector2D OutQuad[4])
+{
+	if (!Rays.bValid) return false;
+
+	const float Height = PlaneZ - Rays.Origin.Z;
+
+	for (int32 i = 0; i < 4; ++i)
+	{
+		const FVector& Direction = Rays.Directions[i];
+
+		// t = (PlaneZ - OriginZ) / DirectionZ, must be in front of the camera
+		if (FMath::Abs(Direction.Z) < KINDA_SMALL_NUMBER) return false;
+
+		const float T = Height / Direction.Z;
+		if (T <= 0.0f) return false;
+
+		OutQuad[i] = FVector2D(Rays.Origin + Direction * T);
+	}
+
+	return true;
+}
+
+bool FCameraFraming::IsInsideQuad(const FVector2D& Point, const FVector2D Quad[4])
+{
+	bool bHasPositive = false;
+	bool bHasNegative = false;
+
+	// Inside a convex quad means on the same side of every edge, whatever the winding
+	for (int32 i = 0; i < 4; ++i)
+	{
+		const FVector2D& A = Quad[i];
+		const FVector2D& B = Quad[(i + 1) % 4];
+		const float Cross = FVector2D::CrossProduct(B - A, Point - A);
+
+		bHasPositive |= Cross > 0.0f;
+		bHasNegative |= Cross < 0.0f;
+	}
+
+	return !(bHasPositive && bHasNegative);
+}
+
+FVector2D FCameraFraming::ClampToQuad(const FVector2D& Point, const FVector2D Quad[4])
+{
+	if (IsInsideQuad(Point, Quad)) return Point;
+
+	FVector2D Closest = Point;
+	float ClosestDistSq = TNumericLimits<float>::Max();
+
+	for (int32 i = 0; i < 4; ++i)
+	{
+		const FVector2D& A = Quad[i];
+		const FVector2D Edge = Quad[(i + 1) % 4] - A;
+		const float EdgeLengthSq = Edge.SizeSquared();
+
+		const float Alpha = EdgeLengthSq > KINDA_SMALL_NUMBER ? FMath::Clamp(FVector2D::DotProduct(Point - A, Edge) / EdgeLengthSq, 0.0f, 1.0f) : 0.0f;
+		const FVector2D Candidate = A + Edge * Alpha;
+		const float DistSq = FVector2D::DistSquared(Point, Candidate);
+
+		if (DistSq < ClosestDistSq)
+		{
+			ClosestDistSq = DistSq;
+			Closest = Candidate;
+		}
+	}
+
+	return Closest;
+}
@@ -0,0 +1,82 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Camera/CameraVisibilitySubsystem.h"
+
+#include "SceneManagement.h"
+#include "Game/GGJStats.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+TStatId UCameraVisibilitySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCameraVisibilitySubsystem, STATGROUP_Tickables);
+}
+
+void UCameraVisibilitySubsystem::Tick(float DeltaTime)
+{
+	LLM_SCOPE_BYTAG(GGJ_Camera);
+
+	bHasView = false;
+	bHasGroundQuad = false;
+
+	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
+	if (!PC || !PC->PlayerCameraManager) return;
+
+	int32 SizeX, SizeY;
+	PC->GetViewportSize(SizeX, SizeY);
+	if (SizeX <= 0 || SizeY <= 0) return;
+
+	FMinimalViewInfo View = PC->PlayerCameraManager->GetCameraCacheView();
+	View.AspectRatio = static_cast<float>(SizeX) / SizeY;
+
+	FMatrix ViewMatrix, ProjectionMatrix, ViewProjectionMatrix;
+	UGameplayStatics::GetViewProjectionMatrix(View, ViewMatrix, ProjectionMatrix, ViewProjectionMatrix);
+	GetViewFrustumBounds(ViewFrustum, ViewProjectionMatrix, false);
+
+	// Gameplay happens around the players' feet, use player 0 as the ground height
+	if (const APawn* Pawn = PC->GetPawn())
+	{
+		GroundZ = Pawn->GetActorLocation().Z;
+	}
+
+	ViewRays = FCameraFraming::ComputeViewRays(View.Location, View.Rotation, View.FOV, FVector2D(SizeX, SizeY), 0.0f);
+	bHasGroundQuad = FCameraFraming::GetPlaneQuad(ViewRays, GroundZ, GroundQuad);
+	bHasView = true;
+}
+
+bool UCameraVisibilitySubsystem::IsOnScreen(const FVector& Location, float Radius) const
+{
+	if (!bHasView) return true;
+
+	return ViewFrustum.IntersectSphere(Location, Radius);
+}
+
+float UCameraVisibilitySubsystem::DistanceOutsideView(const FVector& Location) const
+{
+	if (!bHasGroundQuad) return 0.0f;
+
+	const FVector2D Location2D(Location);
+	return FVector2D::Distance(Location2D, FCameraFraming::ClampToQuad(Location2D, GroundQuad));
+}
+
+void UCameraVisibilitySubsystem::AreOnScreen(TArrayView<const FVector> Locations, float Radius, TArrayView<bool> OutOnScreen) const
+{
+	check(OutOnScreen.Num() >= Locations.Num());
+
+	for (int32 i = 0; i < Locations.Num(); ++i)
+	{
+		OutOnScreen[i] = !bHasView || ViewFrustum.IntersectSphere(Locations[i], Radius);
+	}
+}
+
+void UCameraVisibilitySubsystem::GetDistancesOutsideView(TArrayView<const FVector> Locations, TArrayView<float> OutDistances) const
+{
+	check(OutDistances.Num() >= Locations.Num());
+
+	for (int32 i = 0; i < Locations.Num(); ++i)
+	{
+		OutDistances[i] = DistanceOutsideView(Locations[i]);
+	}
+}
@@ -5,6 +5,8 @@
 #include "Camera/CameraComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerController.h"
+#include "Characters/Components/GGJCharacterMovementComponent.h"
+#include "Game/GGJStats.h"
 
 ASharedCamera::ASharedCamera()
 {
@@ -28,6 +30,8 @@ ASharedCamera::ASharedCamera()
 
 void ASharedCamera::BeginPlay()
 {
+	LLM_SCOPE_BYTAG(GGJ_Camera);
+
 	Super::BeginPlay();
 
 	// Set the initial rotation
@@ -39,12 +43,17 @@ void ASharedCamera::BeginPlay()
 		MaxZoomDistance = BaseDistance + 5000.0f;
 	}
 
+	RegisterExistingPlayers();
+
 	// Snap camera to initial position immediately to avoid drift on start
+	GatherPlayerLocations();
 	UpdateCameraPosition(1000.0f);
 }
 
 void ASharedCamera::Tick(float DeltaTime)
 {
+	LLM_SCOPE_BYTAG(GGJ_Camera);
+
 	Super::Tick(DeltaTime);
 
 	if (GEngine)
@@ -52,67 +61,67 @@ void ASharedCamera::Tick(float DeltaTime)
 		//GEngine->AddOnScreenDebugMessage(50, 0.0f, FColor::Cyan, FString::Printf(TEXT("CAMERA DIST: %.0f | BASE: %.0f | MAX: %.0f"), FVector::Dist(GetActorLocation(), GetActorLocation() + GetActorForwardVector() * 100), BaseDistance, MaxZoomDistance));
 	}
 
+	GatherPlayerLocations();
 	UpdateCameraPosition(DeltaTime);
 	ClampPlayersToScreen();
 }
 
-void ASharedCamera::UpdateCameraPosition(float DeltaTime)
+void ASharedCamera::RegisterPlayer(APawn* Player)
 {
-	TArray<AActor*> Players;
-	GetActivePlayerPawns(Players);
+	if (Player && !Players.Contains(Player))
+	{
+		Players.Add(Player);
+	}
+}
 
-	if (Players.Num() == 0) return;
+void ASharedCamera::UnregisterPlayer(APawn* Player)
+{
+	Players.RemoveSwap(Player);
+}
 
-	FVector SumLocation = FVector::ZeroVector;
-	int32 Count = 0;
-	float MaxSpreadSq = 0.0f;
+void ASharedCamera::GatherPlayerLocations()
+{
+	// Drop pawns destroyed without being unpossessed
+	Players.RemoveAllSwap([](const TWeakObjectPtr<APawn>& Player) { return !Player.IsValid(); });
 
-	// Calculate Centroid and Spread
-	for (AActor* Player : Players)
+	PlayerLocations.Reset(Players.Num());
+	for (const TWeakObjectPtr<APawn>& Player : Players)
 	{
-		if (Player)
-		{
-			SumLocation += Player->GetActorLocation();
-			
-			// Check distance against all other players to find max spread
-			for (AActor* OtherPlayer : Players)
-			{
-				if (Player != OtherPlayer && OtherPlayer)
-				{
-					float DistSq = FVector::DistSquared(Player->GetActorLocation(), OtherPlayer->GetActorLocation());
-					if (DistSq > MaxSpreadSq) MaxSpreadSq = DistSq;
-				}
-			}
-			Count++;
-		}
+		PlayerLocations.Add(Player->GetActorLocation());
 	}
+}
 
-	if (Count > 0)
-	{
-		FVector AverageLocation = SumLocation / Count;
-
-		// Calculate target zoom distance based on player spread
-		float CurrentSpread = FMath::Sqrt(MaxSpreadSq);
-		float TargetDistance = BaseDistance + (CurrentSpread * ZoomFactor);
-		
-		TargetDistance = FMath::Clamp(TargetDistance, MinZoomDistance, MaxZoomDistance);
-		
-		// Determine target position using fixed rotation and calculated distance
-		FVector CameraOffset = -FixedCameraRotation.Vector() * TargetDistance;
-		FVector TargetLocation = AverageLocation + CameraOffset;
-
-		// Smoothly interpolate to target
-		FVector NewLocation = FMath::VInterpTo(GetActorLocation(), TargetLocation, DeltaTime, CameraLagSpeed);
-		SetActorLocation(NewLocation);
-
-		// Ensure rotation stays fixed
-		SetActorRotation(FixedCameraRotation);
-	}
+void ASharedCamera::UpdateCameraPosition(float DeltaTime)
+{
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJCameraUpdate, Camera);
+
+	// Average location and largest distance between two players
+	FVector CenterLocation;
+	float CurrentSpread;
+	if (!FCameraFraming::ComputeFraming(PlayerLocations, CenterLocation, CurrentSpread)) return;
+
+	// Calculate target zoom distance based on player spread
+	float TargetDistance = BaseDistance + (CurrentSpread * ZoomFactor);
+	
+	TargetDistance = FMath::Clamp(TargetDistance, MinZoomDistance, MaxZoomDistance);
+	
+	// Determine target position using fixed rotation and calculated distance
+	FVector CameraOffset = -FixedCameraRotation.Vector() * TargetDistance;
+	FVector TargetLocation = CenterLocation + CameraOffset;
+
+	// Smoothly interpolate to target
+	FVector NewLocation = FMath::VInterpTo(GetActorLocation(), TargetLocation, DeltaTime, CameraLagSpeed);
+	SetActorLocation(NewLocation);
+
+	// Ensure rotation stays fixed
+	SetActorRotation(FixedCameraRotation);
 }
 
 void ASharedCamera::ClampPlayersToScreen()
 {
-	// Use Player 0 controller for viewport projection
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJCameraClamp, Camera);
+
+	// Use Player 0 controller for the viewport size
 	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
 	if (!PC) return;
 
@@ -121,61 +130,46 @@ void ASharedCamera::ClampPlayersToScreen()
 
 	if (SizeX <= 0 || SizeY <= 0) return;
 
-	TArray<AActor*> Players;
-	GetActivePlayerPawns(Players);
+	// The padded screen rectangle as four rays, once per frame. Intersecting them with a
+	// horizontal plane gives the visible quad at that height without any project/deproject.
+	ViewRays = FCameraFraming::ComputeViewRays(CameraComponent->GetComponentLocation(), CameraComponent->GetComponentRotation(),
+		CameraComponent->FieldOfView, FVector2D(SizeX, SizeY), ScreenEdgePadding);
 
-	for (AActor* Player : Players)
+	for (int32 i = 0; i < Players.Num(); ++i)
 	{
-		if (!Player) continue;
+		const FVector& PlayerLoc = PlayerLocations[i];
+
+		FVector2D Quad[4];
+		if (!FCameraFraming::GetPlaneQuad(ViewRays, PlayerLoc.Z, Quad)) continue;
+
+		// Preferred path: the movement component clips its own velocity against the quad during its next move
+		UGGJCharacterMovementComponent* Movement = Cast<UGGJCharacterMovementComponent>(Players[i]->GetMovementComponent());
+		if (Movement && Movement->bConstrainToCameraBounds)
+		{
+			Movement->SetCameraBounds(Quad);
+			continue;
+		}
 
-		FVector PlayerLoc = Player->GetActorLocation();
-		FVector2D ScreenLoc;
+		// Fallback for pawns without it: correct the position after the fact
+		const FVector2D PlayerLoc2D(PlayerLoc);
+		const FVector2D ClampedLoc = FCameraFraming::ClampToQuad(PlayerLoc2D, Quad);
 
-		// Project world location to screen space
-		if (PC->ProjectWorldLocationToScreen(PlayerLoc, ScreenLoc))
+		if (!ClampedLoc.Equals(PlayerLoc2D))
 		{
-			bool bClamped = false;
-
-			// Clamp screen coordinates with padding
-			if (ScreenLoc.X < ScreenEdgePadding) { ScreenLoc.X = ScreenEdgePadding; bClamped = true; }
-			else if (ScreenLoc.X > SizeX - ScreenEdgePadding) { ScreenLoc.X = SizeX - ScreenEdgePadding; bClamped = true; }
-
-			if (ScreenLoc.Y < ScreenEdgePadding) { ScreenLoc.Y = ScreenEdgePadding; bClamped = true; }
-			else if (ScreenLoc.Y > SizeY - ScreenEdgePadding) { ScreenLoc.Y = SizeY - ScreenEdgePadding; bClamped = true; }
-
-			// If clamped, deproject back to world space to find the new valid position
-			if (bClamped)
-			{
-				FVector WorldPos, WorldDir;
-				if (PC->DeprojectScreenPositionToWorld(ScreenLoc.X, ScreenLoc.Y, WorldPos, WorldDir))
-				{
-					// Ray-Plane Intersection:
-					// Find where the deprojected ray intersects the player's current Z plane.
-					// t = (TargetZ - RayOriginZ) / RayDirectionZ
-					if (FMath::Abs(WorldDir.Z) > KINDA_SMALL_NUMBER)
-					{
-						float t = (PlayerLoc.Z - WorldPos.Z) / WorldDir.Z;
-						FVector NewLoc = WorldPos + (WorldDir * t);
-						
-						// Update location with sweep to respect collision
-						Player->SetActorLocation(NewLoc, true);
-					}
-				}
-			}
+			// Update location with sweep to respect collision
+			Players[i]->SetActorLocation(FVector(ClampedLoc, PlayerLoc.Z), true);
 		}
 	}
 }
 
-void ASharedCamera::GetActivePlayerPawns(TArray<AActor*>& OutPlayers) const
+void ASharedCamera::RegisterExistingPlayers()
 {
-	OutPlayers.Reset();
-	// Efficiently iterate local player controllers to find pawns
 	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
 	{
 		APlayerController* PC = Iterator->Get();
 		if (PC && PC->GetPawn())
 		{
-			OutPlayers.Add(PC->GetPawn());
+			RegisterPlayer(PC->GetPawn());
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,137 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Characters/Components/EnemyMovementComponent.h"
+
+#include "Components/CapsuleComponent.h"
+
+namespace EnemyMovement
+{
+	/** Height kept between capsule and floor, like CharacterMovement's MIN_FLOOR_DIST, so XY sweeps never start touching the floor. */
+	constexpr float FloorGap = 2.0f;
+}
+
+UEnemyMovementComponent::UEnemyMovementComponent()
+{
+	bUpdateOnlyIfRendered = false;
+	NavAgentProps.bCanWalk = true;
+	NavAgentProps.bCanJump = false;
+	NavAgentProps.bCanFly = false;
+}
+
+void UEnemyMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	if (ShouldSkipUpdate(DeltaTime)) return;
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!PawnOwner || !UpdatedComponent || DeltaTime <= 0.0f) return;
+
+	// Path following and the crowd request a velocity, anything else goes through the input vector
+	FVector DesiredVelocity = bHasRequestedVelocity ? RequestedVelocity : ConsumeInputVector().GetClampedToMaxSize(1.0f) * MaxSpeed;
+	DesiredVelocity.Z = 0.0f;
+	DesiredVelocity = DesiredVelocity.GetClampedToMaxSize(MaxSpeed);
+	bHasRequestedVelocity = false;
+
+	const float Rate = DesiredVelocity.IsNearlyZero() ? Deceleration : Acceleration;
+	WalkVelocity = FMath::VInterpConstantTo(WalkVelocity, DesiredVelocity, DeltaTime, Rate);
+
+	// Like LaunchCharacter with XY override, which the CharacterMovement path uses: the hit replaces the XY velocity
+	if (bHasPendingKnockback)
+	{
+		KnockbackVelocity = PendingKnockback;
+		WalkVelocity = FVector::ZeroVector;
+		PendingKnockback = FVector::ZeroVector;
+		bHasPendingKnockback = false;
+	}
+
+	KnockbackVelocity *= FMath::Exp(-KnockbackDamping * DeltaTime);
+	if (KnockbackVelocity.SizeSquared() < FMath::Square(10.0f))
+	{
+		KnockbackVelocity = FVector::ZeroVector;
+	}
+
+	Velocity = WalkVelocity + KnockbackVelocity;
+
+	UpdateFloor(DeltaTime);
+
+	FVector Delta = Velocity * DeltaTime;
+	if (bHasFloor)
+	{
+		const UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(UpdatedComponent);
+		const float HalfHeight = Capsule ? Capsule->GetScaledCapsuleHalfHeight() : UpdatedComponent->Bounds.BoxExtent.Z;
+		Delta.Z = FloorZ + HalfHeight + EnemyMovement::FloorGap - UpdatedComponent->GetComponentLocation().Z;
+	}
+
+	if (!Delta.IsNearlyZero())
+	{
+		// Move and slide update the capsule, its children and overlaps once, when the scope ends
+		FScopedMovementUpdate ScopedUpdate(UpdatedComponent, EScopedUpdate::DeferredUpdates);
+
+		// Paths and crowd avoidance do not account for other blockers, so walking is swept like knockback
+		FHitResult Hit;
+		SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+		// A hit with no XY normal is the floor or a ceiling, there is nothing to slide along
+		const FVector WallNormal = Hit.Normal.GetSafeNormal2D();
+		if (Hit.IsValidBlockingHit() && !WallNormal.IsNearlyZero())
+		{
+			SlideAlongSurface(Delta, 1.0f - Hit.Time, WallNormal, Hit);
+			KnockbackVelocity = FVector::VectorPlaneProject(KnockbackVelocity, WallNormal);
+		}
+	}
+
+	UpdateComponentVelocity();
+}
+
+void UEnemyMovementComponent::UpdateFloor(float DeltaTime)
+{
+	TimeSinceFloorProbe += DeltaTime;
+
+	const FVector Location = UpdatedComponent->GetComponentLocation();
+	const FVector2D Location2D(Location);
+
+	if (bHasFloor && TimeSinceFloorProbe < FloorProbeInterval && FVector2D::DistSquared(Location2D, LastFloorProbeLocation) < FMath::Square(FloorProbeDistance)) return;
+
+	TimeSinceFloorProbe = 0.0f;
+	LastFloorProbeLocation = Location2D;
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(EnemyFloorProbe), false, PawnOwner);
+	FHitResult Hit;
+	bHasFloor = GetWorld()->LineTraceSingleByObjectType(Hit, Location, Location - FVector(0.0f, 0.0f, FloorProbeDepth), FCollisionObjectQueryParams(ECC_WorldStatic), Params);
+
+	if (bHasFloor)
+	{
+		FloorZ = Hit.ImpactPoint.Z;
+	}
+}
+
+void UEnemyMovementComponent::RequestDirectMove(const FVector& MoveVelocity, bool bForceMaxSpeed)
+{
+	RequestedVelocity = bForceMaxSpeed ? MoveVelocity.GetSafeNormal() * MaxSpeed : MoveVelocity;
+	bHasRequestedVelocity = true;
+}
+
+void UEnemyMovementComponent::StopActiveMovement()
+{
+	Super::StopActiveMovement();
+
+	RequestedVelocity = FVector::ZeroVector;
+	bHasRequestedVelocity = false;
+}
+
+void UEnemyMovementComponent::StopMovementImmediately()
+{
+	Super::StopMovementImmediately();
+
+	WalkVelocity = FVector::ZeroVector;
+	KnockbackVelocity = FVector::ZeroVector;
+	PendingKnockback = FVector::ZeroVector;
+	bHasPendingKnockback = false;
+}
+
+void UEnemyMovementComponent::AddKnockback(const FVector& Impulse)
+{
+	PendingKnockback += FVector(Impulse.X, Impulse.Y, 0.0f);
+	bHasPendingKnockback = true;
+}
@@ -0,0 +1,251 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Characters/Components/GGJCharacterMovementComponent.h"
+
+void UGGJCharacterMovementComponent::SetCameraBounds(const FVector2D Quad[4])
+{
+	CameraBoundaryPlanes.Reset();
+
+	const FVector2D Center = (Quad[0] + Quad[1] + Quad[2] + Quad[3]) * 0.25f;
+
+	for (int32 i = 0; i < 4; ++i)
+	{
+		const FVector2D A = Quad[i];
+		const FVector2D Edge = Quad[(i + 1) % 4] - A;
+
+		FVector2D Normal = FVector2D(-Edge.Y, Edge.X).GetSafeNormal();
+		if (FVector2D::DotProduct(Center - A, Normal) < 0.0f)
+		{
+			Normal = -Normal;
+		}
+
+		CameraBoundaryPlanes.Add(FPlane(FVector(A, 0.0f), FVector(Normal, 0.0f)));
+	}
+}
+
+void UGGJCharacterMovementComponent::ClearCameraBounds()
+{
+	CameraBoundaryPlanes.Reset();
+}
+
+void UGGJCharacterMovementComponent::CalcVelocity(float DeltaTime, float Friction, bool bFluid, float BrakingDeceleration)
+{
+	Super::CalcVelocity(DeltaTime, Friction, bFluid, BrakingDeceleration);
+
+	Velocity = ClipToCameraBounds(Velocity, DeltaTime);
+}
+
+FVector UGGJCharacterMovementComponent::NewFallVelocity(const FVector& InitialVelocity, const FVector& Gravity, float DeltaTime) const
+{
+	return ClipToCameraBounds(Super::NewFallVelocity(InitialVelocity, Gravity, DeltaTime), DeltaTime);
+}
+
+FVector UGGJCharacterMovementComponent::ClipToCameraBounds(const FVector& InVelocity, float DeltaTime) const
+{
+	if (!bConstrainToCameraBounds || CameraBoundaryPlanes.Num() == 0 || !UpdatedComponent || DeltaTime <= 0.0f) return InVelocity;
+
+	const FVector Location = UpdatedComponent->GetComponentLocation();
+	FVector Result = InVelocity;
+
+	for (const FPlane& Plane : CameraBoundaryPlanes)
+	{
+		const FVector Normal = Plane.GetNormal();
+
+		// Positive inside. Allow exactly the travel that reaches the boundary this step, or
+		// require walking back in if the camera already left us outside.
+		const float Distance = Plane.PlaneDot(Location);
+		const float MinNormalSpeed = Distance >= 0.0f ? -Distance / DeltaTime : FMath::Min(-Distance / DeltaTime, BoundsRecoverySpeed);
+
+		const float NormalSpeed = FVector::DotProduct(Result, Normal);
+		if (NormalSpeed < MinNormalSpeed)
+		{
+			Result += Normal * (MinNormalSpeed - NormalSpeed);
+		}
+	}
+
+	return Result;
+}
+
+EGGJCustomMovementMode UGGJCharacterMovementComponent::GetCustomMovementMode() const
+{
+	return MovementMode == MOVE_Custom ? static_cast<EGGJCustomMovementMode>(CustomMovementMode) : EGGJCustomMovementMode::None;
+}
+
+void UGGJCharacterMovementComponent::StartLunge(const FVector& Target, float TimeConstant)
+{
+	LungeTarget = Target;
+	LungeTimeConstant = FMath::Max(TimeConstant, KINDA_SMALL_NUMBER);
+	StartCustomMovement(EGGJCustomMovementMode::Lunge, FVector::ZeroVector);
+}
+
+void UGGJCharacterMovementComponent::StartRoll(const FVector& RollVelocity)
+{
+	StartCustomMovement(EGGJCustomMovementMode::Roll, FVector(RollVelocity.X, RollVelocity.Y, 0.0f));
+}
+
+void UGGJCharacterMovementComponent::StartKnockdown(const FVector& LaunchVelocity)
+{
+	StartCustomMovement(EGGJCustomMovementMode::Knockdown, LaunchVelocity);
+}
+
+void UGGJCharacterMovementComponent::StartCustomMovement(EGGJCustomMovementMode Mode, const FVector& StartVelocity)
+{
+	if (!UpdatedComponent) return;
+
+	CustomStartLocation = UpdatedComponent->GetComponentLocation();
+	CustomStartVelocity = StartVelocity;
+	CustomElapsedTime = 0.0f;
+	bCustomAirborne = Mode != EGGJCustomMovementMode::Lunge;
+	Velocity = Mode == EGGJCustomMovementMode::Lunge ? FVector::ZeroVector : StartVelocity;
+
+	SetMovementMode(MOVE_Custom, static_cast<uint8>(Mode));
+}
+
+void UGGJCharacterMovementComponent::StopCustomMovement(EGGJCustomMovementMode Mode)
+{
+	if (!IsInCustomMovementMode(Mode)) return;
+
+	SetMovementMode(MOVE_Walking);
+}
+
+void UGGJCharacterMovementComponent::RebaseTrajectory(const FVector& NewStartVelocity)
+{
+	CustomStartLocation = UpdatedComponent->GetComponentLocation();
+	CustomStartVelocity = NewStartVelocity;
+	CustomElapsedTime = 0.0f;
+}
+
+FVector UGGJCharacterMovementComponent::GetTrajectoryLocation(float Time) const
+{
+	switch (GetCustomMovementMode())
+	{
+	case EGGJCustomMovementMode::Lunge:
+		// Same curve the old per-frame VInterpTo approximated
+		return LungeTarget + (CustomStartLocation - LungeTarget) * FMath::Exp(-Time / LungeTimeConstant);
+
+	case EGGJCustomMovementMode::Roll:
+		if (!bCustomAirborne)
+		{
+			return CustomStartLocation + CustomStartVelocity * ((1.0f - FMath::Exp(-RollDamping * Time)) / RollDamping);
+		}
+		// Airborne rolls fly like knockdowns
+		return CustomStartLocation + CustomStartVelocity * Time + FVector(0.0f, 0.0f, 0.5f * GetGravityZ() * Time * Time);
+
+	case EGGJCustomMovementMode::Knockdown:
+		return CustomStartLocation + CustomStartVelocity * Time + FVector(0.0f, 0.0f, 0.5f * GetGravityZ() * Time * Time);
+
+	default:
+		return UpdatedComponent ? UpdatedComponent->GetComponentLocation() : FVector::ZeroVector;
+	}
+}
+
+FVector UGGJCharacterMovementComponent::GetTrajectoryVelocity(float Time) const
+{
+	switch (GetCustomMovementMode())
+	{
+	case EGGJCustomMovementMode::Lunge:
+		return (LungeTarget - CustomStartLocation) * (FMath::Exp(-Time / LungeTimeConstant) / LungeTimeConstant);
+
+	case EGGJCustomMovementMode::Roll:
+		if (!bCustomAirborne)
+		{
+			return CustomStartVelocity * FMath::Exp(-RollDamping * Time);
+		}
+		return CustomStartVelocity + FVector(0.0f, 0.0f, GetGravityZ() * Time);
+
+	case EGGJCustomMovementMode::Knockdown:
+		return CustomStartVelocity + FVector(0.0f, 0.0f, GetGravityZ() * Time);
+
+	default:
+		return Velocity;
+	}
+}
+
+void UGGJCharacterMovementComponent::PhysCustom(float DeltaTime, int32 Iterations)
+{
+	const EGGJCustomMovementMode Mode = GetCustomMovementMode();
+	if (Mode == EGGJCustomMovementMode::None || DeltaTime < MIN_TICK_TIME || !UpdatedComponent)
+	{
+		Super::PhysCustom(DeltaTime, Iterations);
+		return;
+	}
+
+	const float EndTime = CustomElapsedTime + DeltaTime;
+	const FVector Delta = ClipToCameraBounds((GetTrajectoryLocation(EndTime) - GetTrajectoryLocation(CustomElapsedTime)) / DeltaTime, DeltaTime) * DeltaTime;
+
+	FHitResult Hit(1.0f);
+	SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+	CustomElapsedTime = EndTime;
+	Velocity = GetTrajectoryVelocity(EndTime);
+
+	if (Hit.IsValidBlockingHit())
+	{
+		const bool bLanded = bCustomAirborne && Velocity.Z <= 0.0f && IsValidLandingSpot(UpdatedComponent->GetComponentLocation(), Hit);
+
+		if (bLanded && Mode == EGGJCustomMovementMode::Knockdown)
+		{
+			ProcessLanded(Hit, DeltaTime * (1.0f - Hit.Time), Iterations);
+			return;
+		}
+
+		// The roll keeps going on the ground, now damped
+		if (bLanded && Mode == EGGJCustomMovementMode::Roll)
+		{
+			bCustomAirborne = false;
+			RebaseTrajectory(FVector(Velocity.X, Velocity.Y, 0.0f));
+			Velocity = CustomStartVelocity;
+			return;
+		}
+
+		if (Mode == EGGJCustomMovementMode::Lunge)
+		{
+			SetMovementMode(MOVE_Walking);
+			return;
+		}
+
+		SlideAlongSurface(Delta, 1.0f - Hit.Time, Hit.Normal, Hit, true);
+		RebaseTrajectory(FVector::VectorPlaneProject(Velocity, Hit.Normal));
+		Velocity = CustomStartVelocity;
+	}
+
+	switch (Mode)
+	{
+	case EGGJCustomMovementMode::Lunge:
+		if (FVector::DistSquared2D(UpdatedComponent->GetComponentLocation(), LungeTarget) < 1.0f || CustomElapsedTime > MaxCustomMovementTime)
+		{
+			SetMovementMode(MOVE_Walking);
+		}
+		break;
+
+	case EGGJCustomMovementMode::Roll:
+		if (!bCustomAirborne)
+		{
+			// Rolling off a ledge falls with the current speed, as walking off one does
+			FFindFloorResult Floor;
+			FindFloor(UpdatedComponent->GetComponentLocation(), Floor, false);
+			if (!Floor.IsWalkableFloor())
+			{
+				bCustomAirborne = true;
+				RebaseTrajectory(FVector(Velocity.X, Velocity.Y, 0.0f));
+				Velocity = CustomStartVelocity;
+			}
+			else if (Velocity.SizeSquared2D() < FMath::Square(RollMinSpeed))
+			{
+				SetMovementMode(MOVE_Walking);
+			}
+		}
+		break;
+
+	case EGGJCustomMovementMode::Knockdown:
+		if (CustomElapsedTime > MaxCustomMovementTime)
+		{
+			SetMovementMode(MOVE_Falling);
+		}
+		break;
+
+	default:
+		break;
+	}
+}
@@ -6,12 +6,29 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "PaperFlipbookComponent.h"
 #include "AI/EnemyAIController.h"
+#include "AI/EnemyArchetypeRegistry.h"
 #include "AI/EnemyManager.h"
+#include "AI/EnemySpawnerManager.h"
+#include "Animation/EnemyAnimBudgetSubsystem.h"
 #include "Characters/GGJCharacter.h"
+#include "Characters/Components/EnemyMovementComponent.h"
+#include "Debug/CombatTelemetry.h"
+#include "Debug/FlightRecorder.h"
+#include "Debug/Heatmap.h"
 #include "Items/MaskPickup.h"
 #include "Components/BoxComponent.h" 
 #include "Game/GGJPlayerState.h"
+#include "Game/GameplayFramePipeline.h"
+#include "Game/GGJCollision.h"
+#include "Game/GGJStats.h"
 #include "Kismet/GameplayStatics.h"
+#include "Physics/KnockbackPhysicsSubsystem.h"
+#include "Navigation/PathFollowingComponent.h"
+
+static TAutoConsoleVariable<bool> CVarEnemyLightweightMovement(
+	TEXT("ggj.Enemy.LightweightMovement"),
+	false,
+	TEXT("Spawn every enemy with UEnemyMovementComponent instead of CharacterMovement. Applies to enemies spawned afterwards."));
 
 // Sets default values
 AEnemyCharacter::AEnemyCharacter(const FObjectInitializer& ObjectInitializer)
@@ -28,6 +45,10 @@ AEnemyCharacter::AEnemyCharacter(const FObjectInitializer& ObjectInitializer)
 			
 	HealthComp = CreateDefaultSubobject<UHealthComponent>(FName("Health"));
 	
+	LightweightMovement = CreateDefaultSubobject<UEnemyMovementComponent>(TEXT("LightweightMovement"));
+	LightweightMovement->SetUpdatedComponent(GetCapsuleComponent());
+	LightweightMovement->bAutoActivate = false;
+	
 	// --- Sprite Component Setup ---
 	GetSprite()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	GetSprite()->SetCastShadow(true);
@@ -42,11 +63,8 @@ AEnemyCharacter::AEnemyCharacter(const FObjectInitializer& ObjectInitializer)
 		
 	HurtboxComponent->SetupAttachment(GetSprite());
 	HurtboxComponent->SetBoxExtent(FVector(20.f, 10.f, 40.f));
-	HurtboxComponent->SetCollisionObjectType(ECC_GameTraceChannel4);
-	HurtboxComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	HurtboxComponent->SetCollisionResponseToAllChannels(ECR_Ignore);
-	HurtboxComponent->SetCollisionResponseToChannel(ECC_GameTraceChannel3, ECR_Overlap);
-	HurtboxComponent->SetCollisionResponseToChannel(ECC_GameTraceChannel4, ECR_Overlap);
+	// EnemyHurtbox, overlapped by player hitboxes only. Hurtboxes no longer pair with each other
+	HurtboxComponent->SetCollisionProfileName(GGJCollision::EnemyHurtboxProfile);
 	HurtboxComponent->SetGenerateOverlapEvents(false);
 	HurtboxComponent->ComponentTags.Add(TEXT("Hurtbox"));
 	
@@ -57,12 +75,8 @@ AEnemyCharacter::AEnemyCharacter(const FObjectInitializer& ObjectInitializer)
 	// This ensures the hitbox moves correctly when the sprite is flipped (Scale X = -1).
 	HitboxComponent->SetupAttachment(GetSprite()); 
 	HitboxComponent->SetBoxExtent(FVector(30.f, 30.f, 30.f));
-	// Set the hitbox to use our custom "PlayerHitbox" channel
-	HitboxComponent->SetCollisionObjectType(ECC_GameTraceChannel5);
-	// It should ignore everything by default...
-	HitboxComponent->SetCollisionResponseToAllChannels(ECR_Ignore);
-	HitboxComponent->SetCollisionResponseToChannel(ECC_GameTraceChannel6, ECR_Overlap);
-	HitboxComponent->SetCollisionResponseToChannel(ECC_GameTraceChannel5, ECR_Overlap);
+	// EnemyHitBox, overlaps player hurtboxes only
+	HitboxComponent->SetCollisionProfileName(GGJCollision::EnemyHitboxProfile);
 	HitboxComponent->SetGenerateOverlapEvents(false);
 	HitboxComponent->ComponentTags.Add(TEXT("Hitbox"));
 	HitboxComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision); // Disabled by default! Enabled by Animation.
@@ -72,57 +86,120 @@ AEnemyCharacter::AEnemyCharacter(const FObjectInitializer& ObjectInitializer)
 }
 
 // Called when the game starts or when spawned
+void AEnemyCharacter::PostInitializeComponents()
+{
+	bLightweightMovementActive = bUseLightweightMovement || CVarEnemyLightweightMovement.GetValueOnGameThread();
+	
+	if (bLightweightMovementActive)
+	{
+		UCharacterMovementComponent* CharacterMovement = GetCharacterMovement();
+		LightweightMovement->MaxSpeed = CharacterMovement->MaxWalkSpeed;
+		LightweightMovement->Acceleration = CharacterMovement->MaxAcceleration;
+		LightweightMovement->Deceleration = CharacterMovement->BrakingDecelerationWalking;
+		
+		CharacterMovement->Deactivate();
+		CharacterMovement->SetComponentTickEnabled(false);
+		LightweightMovement->Activate();
+		
+		// Moves are kinematic and at most one sweep, CCD only costs here
+		GetCapsuleComponent()->SetUseCCD(false);
+	}
+	
+	// Level-placed enemies pick their archetype by Type. Types without an asset use the values set on this enemy
+	if (UEnemyArchetypeRegistry* Registry = UEnemyArchetypeRegistry::Get(this))
+	{
+		ArchetypeIndex = Registry->ResolveLegacyArchetype(this, FMath::Max(Registry->FindArchetypeIndex(Type), 0));
+	}
+	
+	// Possession happens in here, the override below has to be ready first
+	Super::PostInitializeComponents();
+}
+
+UPawnMovementComponent* AEnemyCharacter::GetMovementComponent() const
+{
+	if (bLightweightMovementActive) return LightweightMovement;
+	
+	return Super::GetMovementComponent();
+}
+
 void AEnemyCharacter::BeginPlay()
 {
+	LLM_SCOPE_BYTAG(GGJ_Enemies);
+	
 	Super::BeginPlay();
 	
 	AttackManager = GetWorld()->GetSubsystem<UEnemyAttackManager>();
 	AIController = Cast<AEnemyAIController>(Controller);
 	
+	if (AIController && bLightweightMovementActive)
+	{
+		AIController->GetPathFollowingComponent()->UpdateCachedComponents();
+	}
+	
 	const FRotator CameraRotation = GetCameraRotation();
 	const float InitialYaw = CameraRotation.Yaw + AnimDirection;
 	LastFacingDirection = FRotator(0.0f, InitialYaw, 0.0f).Vector();
+	
+	if (UGameplayFramePipeline* Pipeline = GetWorld()->GetSubsystem<UGameplayFramePipeline>())
+	{
+		Pipeline->RegisterEnemy(this);
+	}
+	
+	if (UEnemyAnimBudgetSubsystem* AnimBudget = GetWorld()->GetSubsystem<UEnemyAnimBudgetSubsystem>())
+	{
+		AnimBudget->RegisterEnemy(this);
+	}
+}
+
+void AEnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGameplayFramePipeline* Pipeline = GetWorld()->GetSubsystem<UGameplayFramePipeline>())
+	{
+		Pipeline->UnregisterEnemy(this);
+	}
+	
+	if (UEnemyAnimBudgetSubsystem* AnimBudget = GetWorld()->GetSubsystem<UEnemyAnimBudgetSubsystem>())
+	{
+		AnimBudget->UnregisterEnemy(this);
+	}
+	
+	Super::EndPlay(EndPlayReason);
 }
 
 // Called every frame
 void AEnemyCharacter::Tick(float DeltaTime)
 {
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJEnemyTick, AI);
+	
 	Super::Tick(DeltaTime);
+	
+	// Facing and hit resolution run in the frame pipeline when it is active
+	if (bDrivenByFramePipeline) return;
+	
 	UpdateAnimationDirection();
 	
-	if (GetSprite()->DoesSocketExist("Hitbox"))
-	{
-		// const FVector SocketLoc = GetSprite()->GetSocketLocation("Hitbox");
-		// const FVector HitboxLoc = HitboxComponent->GetComponentLocation();
-
-		// UE_LOG(LogTemp, Warning, TEXT("SocketLoc: %s | HitboxLoc: %s"),
-		// 	*SocketLoc.ToString(),
-		// 	*HitboxLoc.ToString());
-
-		// HitboxComponent->SetWorldLocation(SocketLoc);
-		HitboxComponent->UpdateOverlaps();
-		
-		// TArray<UPrimitiveComponent*> OverlappingComps;
-		// HitboxComponent->GetOverlappingComponents(OverlappingComps);
-		// UE_LOG(LogTemp, Warning, TEXT("Hitbox overlapping %d components"), OverlappingComps.Num());
-		// for (auto* Comp : OverlappingComps)
-		// {
-		// 	UE_LOG(LogTemp, Warning, TEXT("  - %s (Owner: %s)"), 
-		// 		*Comp->GetName(),
-		// 		*Comp->GetOwner()->GetName());
-		// }
-	}
-
+	SweepMeleeHitbox();
 }
 
 void AEnemyCharacter::ActivateEnemy()
 {
+	static const FName ActiveState(TEXT("Active"));
+	GGJ_FLIGHT_EVENT(StateChange, GetFName(), ActiveState, 0.0f);
+	
 	// Reset Collisions
 	// SetActorEnableCollision(true);
 	
 	// Reset Movement
-	GetCharacterMovement()->GravityScale = 1.0f;
-	GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+	if (bLightweightMovementActive)
+	{
+		LightweightMovement->InvalidateFloor();
+		LightweightMovement->Activate();
+	}
+	else
+	{
+		GetCharacterMovement()->GravityScale = 1.0f;
+		GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+	}
 	
 	// Restart Animations
 	
@@ -151,20 +228,25 @@ void AEnemyCharacter::DeactivateEnemy()
 	//
 	// IsReset = true;
 	
-	if (Type != EEnemyType::None && PickupClass)
+	// Pooled enemies must not keep their id, a late push from their previous life would move them again
+	UKnockbackPhysicsSubsystem::CancelKnockback(this);
+	
+	const UEnemyArchetype* Archetype = GetArchetype();
+	if (Archetype && Archetype->Type != EEnemyType::None && Archetype->PickupClass)
 	{
 		TArray<AActor*> Masks;
-		UGameplayStatics::GetAllActorsOfClass(GetWorld(), PickupClass, Masks);
+		UGameplayStatics::GetAllActorsOfClass(GetWorld(), Archetype->PickupClass, Masks);
 		
 		if (Masks.Num() < 5)
 		{
-			AMaskPickup* PickMask = Cast<AMaskPickup>(GetWorld()->SpawnActor(PickupClass));
+			LLM_SCOPE_BYTAG(GGJ_Masks);
+			AMaskPickup* PickMask = GetWorld()->SpawnActor<AMaskPickup>(Archetype->PickupClass);
             		
             if (PickMask)
             {
             	PickMask->SetActorLocation(GetActorLocation());
-            	PickMask->MaskType = Type;
-            	PickMask->UpdateVisuals(RedRabbitMaskFlipbook, GreenBirdMaskFlipbook, BlueCatMaskFlipbook);
+            	PickMask->MaskType = Archetype->Type;
+            	PickMask->SetMaskFlipbook(Archetype->MaskFlipbook);
             }
 		}
 		
@@ -173,19 +255,36 @@ void AEnemyCharacter::DeactivateEnemy()
 	// SetActorLocation(SpawnLocation);
 }
 
+void AEnemyCharacter::FinishDeath()
+{
+	DeactivateEnemy();
+	
+	// Removes it from the active enemies, otherwise the spawner stops once MaxEnemies have died
+	if (UEnemySpawnerManager* Spawner = GetWorld()->GetSubsystem<UEnemySpawnerManager>())
+	{
+		Spawner->ResetEnemy(this);
+	}
+}
+
 void AEnemyCharacter::OnBoxBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
                                         UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJHitboxOverlap, Combat);
+	
 	// FIX: Ignore the Player's Hitbox (Weapon) to prevent taking contact damage when attacking the enemy.
-	// ECC_GameTraceChannel3 corresponds to the PlayerHitbox channel.
-	if (OtherComp && OtherComp->GetCollisionObjectType() != ECC_GameTraceChannel6) return;
+	// Only the player's hurtbox counts as being touched.
+	if (OtherComp && OtherComp->GetCollisionObjectType() != GGJCollision::PlayerHurtbox) return;
 	
 	if (OtherActor && OtherActor->IsA<AGGJCharacter>())
 	{
+		// Overlap events and sweeps can both report the same player, one hit per swing
+		if (!HitboxSweep.MarkHit(OtherActor)) return;
 		
-		UE_LOG(LogTemp, Warning, TEXT("Enemy touched Player! Dealing %.1f Damage"), Damage);
+		const float ContactDamage = GetArchetypeData().Damage;
+		UE_LOG(LogGGJCombat, Verbose, TEXT("Enemy touched Player! Dealing %.1f Damage"), ContactDamage);
+		GGJ_COMBAT_EVENT(ContactHit, this, OtherActor, ContactDamage, static_cast<uint8>(ArchetypeIndex));
 
-		UGameplayStatics::ApplyDamage(OtherActor, Damage, GetController(), this, UDamageType::StaticClass());
+		UGameplayFramePipeline::ApplyDamage(OtherActor, ContactDamage, GetController(), this);
 		
 		// If the component that touched the player was the Weapon (Hitbox), mark as hit.
 		if (OverlappedComp == HitboxComponent)
@@ -198,6 +297,8 @@ void AEnemyCharacter::OnBoxBeginOverlap(UPrimitiveComponent* OverlappedComp, AAc
 float AEnemyCharacter::TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent,
 	class AController* EventInstigator, AActor* DamageCauser)
 {
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJTakeDamage, Combat);
+	
 	const float ActualDamage = Super::TakeDamage(DamageAmount, DamageEvent, EventInstigator, DamageCauser);
 
 	const bool bValidSource = DamageCauser && (DamageCauser->IsA<AGGJCharacter>() || DamageCauser->IsA<AMaskPickup>());
@@ -216,7 +317,7 @@ float AEnemyCharacter::TakeDamage(float DamageAmount, struct FDamageEvent const&
 			{
 				if (AGGJPlayerState* PS = Cast<AGGJPlayerState>(Character->GetPlayerState()))
 				{
-					PS->AddScore(ScorePoints);
+					PS->AddScore(GetArchetypeData().ScorePoints);
 				}
 			}
 		}
@@ -225,7 +326,20 @@ float AEnemyCharacter::TakeDamage(float DamageAmount, struct FDamageEvent const&
 			if (DamageCauser)
 			{
 				const FVector KnockbackDir = (GetActorLocation() - DamageCauser->GetActorLocation()).GetSafeNormal2D();
-				LaunchCharacter(KnockbackDir * KnockBackStrenghth, true, true);
+				const FVector KnockbackVelocity = KnockbackDir * GetArchetypeData().KnockBackStrength;
+				
+				// Integrated on the physics thread when async knockback is on
+				if (!UKnockbackPhysicsSubsystem::QueueKnockback(this, KnockbackVelocity))
+				{
+					if (bLightweightMovementActive)
+					{
+						LightweightMovement->AddKnockback(KnockbackVelocity);
+					}
+					else
+					{
+						LaunchCharacter(KnockbackVelocity, true, true);
+					}
+				}
 			}
 		}
 	}
@@ -233,10 +347,37 @@ float AEnemyCharacter::TakeDamage(float DamageAmount, struct FDamageEvent const&
 	return ActualDamage;
 }
 
+void AEnemyCharacter::SetArchetypeIndex(int32 NewIndex)
+{
+	UEnemyArchetypeRegistry* Registry = UEnemyArchetypeRegistry::Get(this);
+	ArchetypeIndex = Registry ? Registry->ResolveLegacyArchetype(this, NewIndex) : NewIndex;
+	Type = GetEnemyType();
+}
+
+const FEnemyArchetypeData& AEnemyCharacter::GetArchetypeData() const
+{
+	return UEnemyArchetypeRegistry::GetData(this, ArchetypeIndex);
+}
+
+const UEnemyArchetype* AEnemyCharacter::GetArchetype() const
+{
+	const UEnemyArchetypeRegistry* Registry = UEnemyArchetypeRegistry::Get(this);
+	return Registry ? Registry->GetArchetype(ArchetypeIndex) : nullptr;
+}
+
+EEnemyType AEnemyCharacter::GetEnemyType() const
+{
+	return GetArchetypeData().Type;
+}
+
 bool AEnemyCharacter::CanAttack()
 {
 	if (AttackManager)
 	{
+		// Free tokens go to the enemies best placed to attack last frame, not whoever asks first
+		const UGameplayFramePipeline* Pipeline = GetWorld()->GetSubsystem<UGameplayFramePipeline>();
+		if (Pipeline && !AttackManager->HasToken(this) && !Pipeline->IsAttackSlotCandidate(this)) return false;
+		
 		return AttackManager->RequestAttack(this);
 	}
 	
@@ -255,12 +396,26 @@ void AEnemyCharacter::AttackFinished()
 
 void AEnemyCharacter::OnDeath()
 {
+	static const FName DeadState(TEXT("Dead"));
+	GGJ_FLIGHT_EVENT(StateChange, GetFName(), DeadState, 0.0f);
+	GGJ_COMBAT_EVENT(Death, this, nullptr, 0.0f, static_cast<uint8>(ArchetypeIndex));
+	UHeatmapSubsystem::Record(this, EGGJHeatmapLayer::EnemyDeath, GetActorLocation());
+	
 	// Trigger Blueprint Event (Sound, VFX, Animation)
 	OnEnemyDied();
 
 	// Deactivate Movement
-	GetCharacterMovement()->StopMovementImmediately();
-	GetCharacterMovement()->SetMovementMode(MOVE_None);
+	UKnockbackPhysicsSubsystem::CancelKnockback(this);
+	if (bLightweightMovementActive)
+	{
+		LightweightMovement->StopMovementImmediately();
+		LightweightMovement->Deactivate();
+	}
+	else
+	{
+		GetCharacterMovement()->StopMovementImmediately();
+		GetCharacterMovement()->SetMovementMode(MOVE_None);
+	}
 		
 	// Deactivate Collisions
 	SetActorEnableCollision(false);
@@ -283,15 +438,43 @@ void AEnemyCharacter::ActivateMeleeHitbox(FName SocketName, FVector Extent)
 		HitboxComponent->SetBoxExtent(Extent);
 		HitboxComponent->SetGenerateOverlapEvents(true);
 		HitboxComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-		HitboxComponent->UpdateOverlaps();
 		
 		// Reset hit tracker for this new swing
 		bHasHitPlayer = false;
+		HitboxSweep.Begin(HitboxComponent);
+		
+		HitboxComponent->UpdateOverlaps();
 	}	
 }
 
+void AEnemyCharacter::SweepMeleeHitbox()
+{
+	TArray<FHitResult> Hits;
+	HitboxSweep.Sweep(HitboxComponent, Hits);
+	
+	for (const FHitResult& Hit : Hits)
+	{
+		ResolveHitboxHit(Hit);
+	}
+}
+
+void AEnemyCharacter::ResolveHitboxHit(const FHitResult& Hit)
+{
+	OnBoxBeginOverlap(HitboxComponent, Hit.GetActor(), Hit.GetComponent(), Hit.Item, true, Hit);
+}
+
 void AEnemyCharacter::DeactivateMeleeHitbox()
 {
+	// Last sweep closes the window, even if it opened and closed within one frame. Dead enemies deal no damage
+	if (HitboxSweep.IsActive())
+	{
+		if (!HealthComp->IsActorDead())
+		{
+			SweepMeleeHitbox();
+		}
+		HitboxSweep.End();
+	}
+	
 	HitboxComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	
 	// Trigger the Blueprint event with the result of the attack
@@ -300,34 +483,15 @@ void AEnemyCharacter::DeactivateMeleeHitbox()
 
 void AEnemyCharacter::UpdateAnimationDirection()
 {
-	const FVector Velocity = GetVelocity();
-
-	// Update LastFacingDirection from Velocity if moving significantly.
 	// If not moving, LastFacingDirection retains the last Input (updated in ApplyMovementInput).
-	if (Velocity.SizeSquared2D() > 1.0f)
-	{
-		LastFacingDirection = Velocity.GetSafeNormal2D();
-	}
-	
-	const FRotator CameraRotation = GetCameraRotation();
-	const FRotator TargetRotation = LastFacingDirection.ToOrientationRotator();
-
-	// Calculate the angle difference between the camera direction and velocity direction
-	// This allows the AnimBP to select the correct directional animation (Front, Back, Side)
-	const float DeltaYaw = FRotator::NormalizeAxis(TargetRotation.Yaw - CameraRotation.Yaw);
+	float DeltaYaw;
+	bool bFlipped;
+	UGameplayFramePipeline::ComputeFacing(GetVelocity(), LastFacingDirection, GetCameraRotation().Yaw, LastFacingDirection, DeltaYaw, bFlipped);
 
+	// Selects the directional animation (Front, Back, Side) in the AnimBP
 	AnimDirection = DeltaYaw;
 
-	// Flip sprite based on movement direction relative to the camera.
-	// DeltaYaw is approx -90 for left (flip), +90 for right (normal).
-	if (DeltaYaw < -5.0f && DeltaYaw > -175.0f)
-	{
-		GetSprite()->SetRelativeScale3D(FVector(-1.0f, 1.0f, 1.3f));
-	}
-	else
-	{
-		GetSprite()->SetRelativeScale3D(FVector(1.0f, 1.0f, 1.3f));
-	}
+	GetSprite()->SetRelativeScale3D(FVector(bFlipped ? -1.0f : 1.0f, 1.0f, 1.3f));
 }
 
 FRotator AEnemyCharacter::GetCameraRotation() const
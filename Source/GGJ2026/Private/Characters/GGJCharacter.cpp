@@ -19,10 +19,19 @@
 #include "GameFramework/DamageType.h"
 #include "InputMappingContext.h"
 #include "Game/GGJGamemode.h"
+#include "Game/GameplayFramePipeline.h"
+#include "Camera/SharedCamera.h"
+#include "Game/GGJCollision.h"
+#include "Game/GGJStats.h"
+#include "Physics/KnockbackPhysicsSubsystem.h"
+#include "Characters/Components/GGJCharacterMovementComponent.h"
+#include "Debug/CombatTelemetry.h"
+#include "Debug/FlightRecorder.h"
+#include "Debug/Heatmap.h"
 
 
 AGGJCharacter::AGGJCharacter(const FObjectInitializer& ObjectInitializer)
-	: Super(ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UGGJCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 #pragma region Components Setup
 	// Capsule Setup
@@ -76,13 +85,8 @@ AGGJCharacter::AGGJCharacter(const FObjectInitializer& ObjectInitializer)
 	HurtboxComponent = CreateDefaultSubobject<UBoxComponent>(TEXT("Hurtbox"));
 	HurtboxComponent->SetupAttachment(GetSprite()); // Attach to sprite so it follows visual representation
 	HurtboxComponent->SetBoxExtent(FVector(20.f, 10.f, 40.f)); // Made it thinner
-	// Set the hurtbox to be of the "Pawn" object type
-	HurtboxComponent->SetCollisionObjectType(ECC_GameTraceChannel6);
-	// It should generate overlap events but not block anything by default
-	HurtboxComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	HurtboxComponent->SetCollisionResponseToAllChannels(ECR_Ignore);
-	HurtboxComponent->SetCollisionResponseToChannel(ECC_GameTraceChannel5, ECR_Overlap);
-	HurtboxComponent->SetCollisionResponseToChannel(ECC_GameTraceChannel6, ECR_Overlap);
+	// PlayerHurtBox, overlapped by enemy hitboxes only
+	HurtboxComponent->SetCollisionProfileName(GGJCollision::PlayerHurtboxProfile);
 	HurtboxComponent->SetGenerateOverlapEvents(false);
 	
 	// Mask Sprite Setup
@@ -96,10 +100,7 @@ AGGJCharacter::AGGJCharacter(const FObjectInitializer& ObjectInitializer)
 	HitboxComponent = CreateDefaultSubobject<UBoxComponent>(TEXT("Hitbox"));
 	HitboxComponent->SetupAttachment(GetSprite()); 
 	HitboxComponent->SetBoxExtent(FVector(30.f, 30.f, 30.f));
-	HitboxComponent->SetCollisionObjectType(ECC_GameTraceChannel3); // PlayerHitbox
-	HitboxComponent->SetCollisionResponseToAllChannels(ECR_Ignore);
-	HitboxComponent->SetCollisionResponseToChannel(ECC_GameTraceChannel4, ECR_Overlap); // EnemyHurtbox
-	HitboxComponent->SetCollisionResponseToChannel(ECC_GameTraceChannel3, ECR_Overlap); // EnemyHurtbox
+	HitboxComponent->SetCollisionProfileName(GGJCollision::PlayerHitboxProfile); // Overlaps EnemyHurtbox
 	HitboxComponent->SetGenerateOverlapEvents(false);
 	HitboxComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision); // Disabled by default! Enabled by Animation.
 	
@@ -161,7 +162,6 @@ void AGGJCharacter::BeginPlay()
 	GetCharacterMovement()->SetMovementMode(MOVE_Walking);
 
 	// Save defaults for restoration
-	DefaultBrakingDeceleration = GetCharacterMovement()->BrakingDecelerationWalking;
 	DefaultRollCooldown = RollCooldown;
 	DefaultMaxWalkSpeed = GetCharacterMovement()->MaxWalkSpeed;
 	
@@ -190,37 +190,53 @@ void AGGJCharacter::BeginPlay()
 	const FRotator CameraRotation = GetCameraRotation();
 	const float InitialYaw = CameraRotation.Yaw + AnimDirection;
 	LastFacingDirection = FRotator(0.0f, InitialYaw, 0.0f).Vector();
+
+	if (UGameplayFramePipeline* Pipeline = GetWorld()->GetSubsystem<UGameplayFramePipeline>())
+	{
+		Pipeline->RegisterPlayer(this);
+	}
+}
+
+void AGGJCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGameplayFramePipeline* Pipeline = GetWorld()->GetSubsystem<UGameplayFramePipeline>())
+	{
+		Pipeline->UnregisterPlayer(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AGGJCharacter::Tick(float DeltaSeconds)
 {
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJPlayerTick, Combat);
+
 	Super::Tick(DeltaSeconds);
 
-	// Handle Lunge movement interpolation
-	if (bIsLunging)
+	if (ActionState != RecordedActionState)
 	{
-		const float LungeDuration = 0.15f;
-		SetActorLocation(FMath::VInterpTo(GetActorLocation(), LungeTargetLocation, DeltaSeconds, 1.0f / LungeDuration)); 
+		GGJ_FLIGHT_EVENT(StateChange, GetFName(), StaticEnum<ECharacterActionState>()->GetNameByValue(static_cast<int64>(ActionState)), static_cast<float>(ActionState));
+		RecordedActionState = ActionState;
 	}
 
 	// Calculate speed and movement state for AnimBP
 	Speed = GetVelocity().Size2D();
 	bIsMoving = Speed > 1.0f;
 
-	// Update jumping state (True if in air)
-	bIsJumping = GetCharacterMovement()->IsFalling();
+	// Update jumping state (True if in air), knockdowns and airborne rolls are custom modes, not falling
+	bIsJumping = GetCharacterMovement<UGGJCharacterMovementComponent>()->IsAirborne();
 	VerticalVelocity = GetVelocity().Z;
-
-	UpdateAnimationDirection();
-	UpdateDirectionalArrow();
 	
 	// Reset input flag for the next frame
 	bHasMovementInput = false;
+
+	// Facing, arrow and hit resolution run in the frame pipeline when it is active
+	if (bDrivenByFramePipeline) return;
+
+	UpdateAnimationDirection();
+	UpdateDirectionalArrow();
 	
-	if (GetSprite()->DoesSocketExist("Hitbox"))
-	{
-		HitboxComponent->UpdateOverlaps();
-	}
+	SweepMeleeHitbox();
 }
 
 void AGGJCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -280,6 +296,30 @@ void AGGJCharacter::PawnClientRestart()
 	}
 }
 
+void AGGJCharacter::PossessedBy(AController* NewController)
+{
+	Super::PossessedBy(NewController);
+
+	// Let the shared camera frame this pawn without searching for players every frame
+	if (NewController && NewController->IsPlayerController())
+	{
+		if (ASharedCamera* SharedCamera = Cast<ASharedCamera>(UGameplayStatics::GetActorOfClass(this, ASharedCamera::StaticClass())))
+		{
+			SharedCamera->RegisterPlayer(this);
+		}
+	}
+}
+
+void AGGJCharacter::UnPossessed()
+{
+	if (ASharedCamera* SharedCamera = Cast<ASharedCamera>(UGameplayStatics::GetActorOfClass(this, ASharedCamera::StaticClass())))
+	{
+		SharedCamera->UnregisterPlayer(this);
+	}
+
+	Super::UnPossessed();
+}
+
 #pragma region Movement Logic
 
 FRotator AGGJCharacter::GetCameraRotation() const
@@ -294,19 +334,10 @@ FRotator AGGJCharacter::GetCameraRotation() const
 
 void AGGJCharacter::UpdateAnimationDirection()
 {
-	const FVector Velocity = GetVelocity();
-
 	// Update LastFacingDirection from Velocity if moving
-	if (Velocity.SizeSquared2D() > 1.0f)
-	{
-		LastFacingDirection = Velocity.GetSafeNormal2D();
-	}
-	
-	const FRotator CameraRotation = GetCameraRotation();
-	const FRotator TargetRotation = LastFacingDirection.ToOrientationRotator();
-
-	// Calculate angle difference for AnimBP directional blend
-	const float DeltaYaw = FRotator::NormalizeAxis(TargetRotation.Yaw - CameraRotation.Yaw);
+	float DeltaYaw;
+	bool bFlipped;
+	UGameplayFramePipeline::ComputeFacing(GetVelocity(), LastFacingDirection, GetCameraRotation().Yaw, LastFacingDirection, DeltaYaw, bFlipped);
 
 	AnimDirection = DeltaYaw;
 
@@ -314,14 +345,7 @@ void AGGJCharacter::UpdateAnimationDirection()
 	const float PerspectiveCorrection = 1.3f;
 
 	// Flip sprite based on direction
-	if (DeltaYaw < -5.0f && DeltaYaw > -175.0f)
-	{
-		GetSprite()->SetRelativeScale3D(FVector(-1.0f, 1.0f, PerspectiveCorrection));
-	}
-	else
-	{
-		GetSprite()->SetRelativeScale3D(FVector(1.0f, 1.0f, PerspectiveCorrection));
-	}
+	GetSprite()->SetRelativeScale3D(FVector(bFlipped ? -1.0f : 1.0f, 1.0f, PerspectiveCorrection));
 }
 
 void AGGJCharacter::UpdateDirectionalArrow()
@@ -384,6 +408,8 @@ void AGGJCharacter::ApplyMovementInput(FVector2D MovementVector, bool IgnoreStat
 
 void AGGJCharacter::OnHitboxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJHitboxOverlap, Combat);
+
 	if (OtherActor == this) return;
 
 	// Only deal damage if we are actually in the Attacking state.
@@ -396,16 +422,17 @@ void AGGJCharacter::OnHitboxOverlap(UPrimitiveComponent* OverlappedComponent, AA
 	{
 		// Calculate damage based on current combo index
 		float DamageToDeal = 10.0f; // Fallback default
-		if (ComboDamageValues.IsValidIndex(AttackComboIndex))
+		const int32 DamageIndex = HitboxDamageIndex != INDEX_NONE ? HitboxDamageIndex : AttackComboIndex;
+		if (ComboDamageValues.IsValidIndex(DamageIndex))
 		{
-			DamageToDeal = ComboDamageValues[AttackComboIndex];
+			DamageToDeal = ComboDamageValues[DamageIndex];
 		}
 
 		// Apply Charge Multiplier
 		DamageToDeal *= CurrentDamageMultiplier;
 
-		// Apply Damage via GameplayStatics
-		UGameplayStatics::ApplyDamage(OtherActor, DamageToDeal, GetController(), this, UDamageType::StaticClass());
+		// Apply Damage (deferred to the pipeline damage stage while hits are being resolved)
+		UGameplayFramePipeline::ApplyDamage(OtherActor, DamageToDeal, GetController(), this);
 		
 		// Mask effects
 		if (bExtendsDurationOnHit)
@@ -426,6 +453,8 @@ void AGGJCharacter::OnHitboxOverlap(UPrimitiveComponent* OverlappedComponent, AA
 
 void AGGJCharacter::OnStunFinished()
 {
+	GGJ_FLIGHT_TIMER(OnStunFinished);
+
 	if (ActionState == ECharacterActionState::Hurt)
 	{
 		ActionState = ECharacterActionState::None;
@@ -434,6 +463,8 @@ void AGGJCharacter::OnStunFinished()
 
 void AGGJCharacter::OnGroundedTimerFinished()
 {
+	GGJ_FLIGHT_TIMER(OnGroundedTimerFinished);
+
 	if (ActionState == ECharacterActionState::Grounded)
 	{
 		ActionState = ECharacterActionState::GettingUp;
@@ -443,6 +474,8 @@ void AGGJCharacter::OnGroundedTimerFinished()
 
 void AGGJCharacter::ResetHitCount()
 {
+	GGJ_FLIGHT_TIMER(ResetHitCount);
+
 	CurrentHitCount = 0;
 }
 
@@ -457,6 +490,8 @@ void AGGJCharacter::OnGetUpFinished()
 
 void AGGJCharacter::DisableInvincibility()
 {
+	GGJ_FLIGHT_TIMER(DisableInvincibility);
+
 	bIsInvincible = false;
 	OnInvincibilityEnded();
 }
@@ -476,7 +511,7 @@ void AGGJCharacter::InterruptCombatActions()
 	
 	// Reset flags
 	bPendingCombo = false;
-	bIsLunging = false;
+	GetCharacterMovement<UGGJCharacterMovementComponent>()->StopCustomMovement(EGGJCustomMovementMode::Lunge);
 	CurrentChargeTime = 0.0f;
 }
 
@@ -516,11 +551,11 @@ void AGGJCharacter::HandleKnockdown(AActor* DamageCauser)
 
 	GetCharacterMovement()->StopMovementImmediately();
 
-	// Add Z velocity to force 'Falling' state, ensuring 'Landed' event fires
+	// Upward component so the arc ends in a landing, which fires 'Landed'
 	FVector LaunchVelocity = KnockbackDir.GetSafeNormal() * KnockdownPushStrength;
 	LaunchVelocity.Z = 400.0f; 
 
-	LaunchCharacter(LaunchVelocity, true, true);
+	GetCharacterMovement<UGGJCharacterMovementComponent>()->StartKnockdown(LaunchVelocity);
 }
 
 void AGGJCharacter::HandleHurt(AActor* DamageCauser)
@@ -528,15 +563,22 @@ void AGGJCharacter::HandleHurt(AActor* DamageCauser)
 	ActionState = ECharacterActionState::Hurt;
 
 	// Apply Knockback
+	FVector KnockbackVelocity;
 	if (DamageCauser)
 	{
 		const FVector KnockbackDir = (GetActorLocation() - DamageCauser->GetActorLocation()).GetSafeNormal2D();
-		LaunchCharacter(KnockbackDir * KnockbackStrength, true, true);
+		KnockbackVelocity = KnockbackDir * KnockbackStrength;
 	}
 	else
 	{
 		// Fallback: Apply small knockback opposite to facing if damage source is unknown.
-		LaunchCharacter(-LastFacingDirection.GetSafeNormal() * (KnockbackStrength * 0.5f), true, true);
+		KnockbackVelocity = -LastFacingDirection.GetSafeNormal() * (KnockbackStrength * 0.5f);
+	}
+
+	// Integrated on the physics thread when async knockback is on
+	if (!UKnockbackPhysicsSubsystem::QueueKnockback(this, KnockbackVelocity))
+	{
+		LaunchCharacter(KnockbackVelocity, true, true);
 	}
 
 	// Set Stun Timer (When to regain control)
@@ -558,6 +600,7 @@ void AGGJCharacter::HandleDeath()
 	bIsInvincible = false;
 
 	ActionState = ECharacterActionState::Dead;
+	GGJ_COMBAT_EVENT(Death, this, nullptr, 0.0f, 0);
 	
 	if (APlayerController* PC = Cast<APlayerController>(Controller))
 	{
@@ -581,11 +624,15 @@ void AGGJCharacter::HandleDeath()
 
 void AGGJCharacter::ResetGlobalTimeDilation()
 {
+	GGJ_FLIGHT_TIMER(ResetGlobalTimeDilation);
+
 	UGameplayStatics::SetGlobalTimeDilation(GetWorld(), 1.0f);
 }
 
 float AGGJCharacter::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
 {
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJTakeDamage, Combat);
+
 	float ActualDamage = Super::TakeDamage(DamageAmount, DamageEvent, EventInstigator, DamageCauser);
 
 	if (ActionState == ECharacterActionState::Dead || ActionState == ECharacterActionState::Rolling ||
@@ -604,6 +651,8 @@ float AGGJCharacter::TakeDamage(float DamageAmount, FDamageEvent const& DamageEv
 
 	if (ActualDamage <= 0.0f) return 0.0f;
 
+	UHeatmapSubsystem::Record(this, EGGJHeatmapLayer::PlayerHit, GetActorLocation());
+
 	CurrentHealth = FMath::Clamp(CurrentHealth - ActualDamage, 0.0f, MaxHealth);
 
 	if (CurrentHealth <= 0.0f)
@@ -657,6 +706,8 @@ void AGGJCharacter::Landed(const FHitResult& Hit)
 
 AActor* AGGJCharacter::FindBestTarget(FVector InputDirection)
 {
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJFindBestTarget, Combat);
+
 	FVector SearchDirection;
 
 	if (InputDirection.SizeSquared() > 0.01f)
@@ -691,43 +742,56 @@ AActor* AGGJCharacter::FindBestTarget(FVector InputDirection)
 		OverlapResults,
 		StartLoc,
 		FQuat::Identity,
-		ECC_GameTraceChannel3,
+		GGJCollision::PlayerHitbox,
 		FCollisionShape::MakeSphere(LungeRange),
 		Params
 	);
 
-	AActor* BestTarget = nullptr;
-	float BestDistanceSq = FLT_MAX;
-	
-	const float MinDotProduct = FMath::Cos(FMath::DegreesToRadians(LungeHalfAngle));
+	TArray<AEnemyCharacter*, TInlineAllocator<16>> Enemies;
+	TArray<FVector, TInlineAllocator<16>> EnemyLocations;
 
 	for (const FOverlapResult& Overlap : OverlapResults)
 	{
 		if (AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(Overlap.GetActor()))
 		{
-			FVector DirToEnemy = (Enemy->GetActorLocation() - StartLoc);
-			float DistSq = DirToEnemy.SizeSquared();
-			DirToEnemy.Normalize();
+			Enemies.Add(Enemy);
+			EnemyLocations.Add(Enemy->GetActorLocation());
+		}
+	}
+	
+	const int32 BestIndex = SelectLungeTarget(StartLoc, SearchDirection, LungeHalfAngle, EnemyLocations);
+	return BestIndex != INDEX_NONE ? Enemies[BestIndex] : nullptr;
+}
+
+int32 AGGJCharacter::SelectLungeTarget(const FVector& Origin, const FVector& Direction, float HalfAngle, TArrayView<const FVector> Candidates)
+{
+	int32 BestIndex = INDEX_NONE;
+	float BestDistanceSq = FLT_MAX;
+	
+	const float MinDotProduct = FMath::Cos(FMath::DegreesToRadians(HalfAngle));
 
-			float Dot = FVector::DotProduct(SearchDirection, DirToEnemy);
+	for (int32 i = 0; i < Candidates.Num(); ++i)
+	{
+		FVector DirToEnemy = (Candidates[i] - Origin);
+		float DistSq = DirToEnemy.SizeSquared();
+		DirToEnemy.Normalize();
 
-			if (Dot >= MinDotProduct)
-			{
-				if (DistSq < BestDistanceSq)
-				{
-					BestDistanceSq = DistSq;
-					BestTarget = Enemy;
-				}
-			}
+		float Dot = FVector::DotProduct(Direction, DirToEnemy);
+
+		if (Dot >= MinDotProduct && DistSq < BestDistanceSq)
+		{
+			BestDistanceSq = DistSq;
+			BestIndex = i;
 		}
 	}
 	
-	return BestTarget;
+	return BestIndex;
 }
 
 void AGGJCharacter::PerformLunge(AActor* Target)
 {
-	if (!Target || bIsLunging) return;
+	UGGJCharacterMovementComponent* Movement = GetCharacterMovement<UGGJCharacterMovementComponent>();
+	if (!Target || Movement->IsInCustomMovementMode(EGGJCustomMovementMode::Lunge)) return;
 
 	// --- 1. Determine Final Destination ---
 	const FRotator CamRot = GetCameraRotation();
@@ -779,19 +843,15 @@ void AGGJCharacter::PerformLunge(AActor* Target)
 		SetActorRotation(DirToActualTarget.Rotation());
 	}
 	
-	// Set the lunge state and target location. The Tick function will handle the movement.
-	bIsLunging = true;
-	LungeTargetLocation = DestinationPoint;
-	
-	// Disable physics-based movement during the lunge for full control
-	GetCharacterMovement()->SetMovementMode(MOVE_Flying);
+	// The movement component follows the lunge trajectory until the target is reached or the attack ends
+	Movement->StartLunge(DestinationPoint, LungeDuration);
 }
 
 #pragma endregion
 
 #pragma region Hitbox Management
 
-void AGGJCharacter::ActivateMeleeHitbox(FName SocketName, FVector Extent)
+void AGGJCharacter::ActivateMeleeHitbox(FName SocketName, FVector Extent, int32 DamageIndex)
 {
 	if (!GetSprite()->DoesSocketExist(SocketName))
 	{
@@ -801,15 +861,41 @@ void AGGJCharacter::ActivateMeleeHitbox(FName SocketName, FVector Extent)
 	HitboxComponent->AttachToComponent(GetSprite(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, SocketName);
 	
 	HitActors.Empty();
+	HitboxDamageIndex = DamageIndex;
 
 	HitboxComponent->SetBoxExtent(Extent);
 	HitboxComponent->SetGenerateOverlapEvents(true);
 	HitboxComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	HitboxComponent->UpdateOverlaps();
+
+	HitboxSweep.Begin(HitboxComponent);
+}
+
+void AGGJCharacter::SweepMeleeHitbox()
+{
+	TArray<FHitResult> Hits;
+	HitboxSweep.Sweep(HitboxComponent, Hits);
+
+	for (const FHitResult& Hit : Hits)
+	{
+		ResolveHitboxHit(Hit);
+	}
+}
+
+void AGGJCharacter::ResolveHitboxHit(const FHitResult& Hit)
+{
+	OnHitboxOverlap(HitboxComponent, Hit.GetActor(), Hit.GetComponent(), Hit.Item, true, Hit);
 }
 
 void AGGJCharacter::DeactivateMeleeHitbox()
 {
+	// Last sweep closes the window, even if it opened and closed within one frame
+	if (HitboxSweep.IsActive())
+	{
+		SweepMeleeHitbox();
+		HitboxSweep.End();
+	}
+
 	HitboxComponent->SetGenerateOverlapEvents(false);
 	HitboxComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	HitboxComponent->UpdateOverlaps();
@@ -929,12 +1015,7 @@ void AGGJCharacter::OnAttackFinished()
 	ActionState = ECharacterActionState::None;
 
 	// If we were lunging, stop it and restore normal movement physics
-	if (bIsLunging)
-	{
-		bIsLunging = false;
-		GetCharacterMovement()->SetMovementMode(MOVE_Walking);
-		GetCharacterMovement()->BrakingDecelerationWalking = DefaultBrakingDeceleration;
-	}
+	GetCharacterMovement<UGGJCharacterMovementComponent>()->StopCustomMovement(EGGJCustomMovementMode::Lunge);
 
 	// Start the timer. If the player doesn't attack again within 'ComboWindowTime', the combo resets.
 	GetWorld()->GetTimerManager().SetTimer(ComboTimerHandle, this, &AGGJCharacter::ResetCombo, ComboWindowTime, false);
@@ -942,6 +1023,8 @@ void AGGJCharacter::OnAttackFinished()
  
 void AGGJCharacter::ResetCombo()
 {
+	GGJ_FLIGHT_TIMER(ResetCombo);
+
 	AttackComboIndex = 0;
 }
 
@@ -1009,11 +1092,8 @@ void AGGJCharacter::PerformRoll()
 		ArrowPivot->SetWorldRotation(ArrowTarget);
 	}
 
-	// Disable braking for smooth slide
-	GetCharacterMovement()->BrakingDecelerationWalking = 0.0f;
-	GetCharacterMovement()->GroundFriction = 2.0f; // Lower friction to slide farther
-	// Override Z (true) to 0.0f to lock vertical movement and prevent hopping/diving on slopes
-	LaunchCharacter(RollDirection * RollSpeed, true, true); 
+	// Planar slide with its own damping, no friction or braking changes needed
+	GetCharacterMovement<UGGJCharacterMovementComponent>()->StartRoll(RollDirection * RollSpeed);
 
 	ActionState = ECharacterActionState::Rolling;
 
@@ -1028,14 +1108,15 @@ void AGGJCharacter::OnRollFinished()
 	{
 		ActionState = ECharacterActionState::None;
 		
-		// Restore normal braking so we stop when releasing keys
-		GetCharacterMovement()->GroundFriction = 3.0f; // Restore original friction
-		GetCharacterMovement()->BrakingDecelerationWalking = DefaultBrakingDeceleration;
+		// Back to walking, regular braking stops us when releasing keys
+		GetCharacterMovement<UGGJCharacterMovementComponent>()->StopCustomMovement(EGGJCustomMovementMode::Roll);
 	}
 }
 
 void AGGJCharacter::ResetRollCooldown()
 {
+	GGJ_FLIGHT_TIMER(ResetRollCooldown);
+
 	bIsRollOnCooldown = false;
 }
 
@@ -1096,6 +1177,7 @@ void AGGJCharacter::LaunchMask()
 	if (CurrentMaskType == EEnemyType::None) return;
 
 	// Spawn mask projectile
+	LLM_SCOPE_BYTAG(GGJ_Masks);
 	FActorSpawnParameters SpawnParams;
 	SpawnParams.Owner = this;
 	SpawnParams.Instigator = this;
@@ -1110,6 +1192,7 @@ void AGGJCharacter::LaunchMask()
 		ThrownMask->MaskType = CurrentMaskType;
 		ThrownMask->UpdateVisuals(RedRabbitMaskFlipbook, GreenBirdMaskFlipbook, BlueCatMaskFlipbook);
 		ThrownMask->InitializeThrow(LastFacingDirection, this);
+		UHeatmapSubsystem::Record(this, EGGJHeatmapLayer::MaskThrow, SpawnLoc);
 		
 		OnMaskLaunched();
 		// Unequip without destroying the new actor
@@ -1173,17 +1256,15 @@ void AGGJCharacter::UnequipMask()
 
 void AGGJCharacter::UpdateMaskDuration()
 {
+	GGJ_FLIGHT_TIMER(UpdateMaskDuration);
+
 	if (CurrentMaskType == EEnemyType::None || ActionState == ECharacterActionState::Dead)
 	{
 		GetWorld()->GetTimerManager().ClearTimer(MaskDurationTimerHandle);
 		return;
 	}
 
-	// Decrease duration by 1 second, scaled by the current drain multiplier
-	CurrentMaskDuration -= (1.0f * DrainRateMultiplier);
-
-	// Increase the drain rate for the next second, making it harder to maintain
-	DrainRateMultiplier += DrainIncreaseRate;
+	CurrentMaskDuration = DrainMaskDuration(CurrentMaskDuration, DrainRateMultiplier, DrainIncreaseRate);
 
 	if (CurrentMaskDuration <= 0.0f)
 	{
@@ -1191,6 +1272,17 @@ void AGGJCharacter::UpdateMaskDuration()
 	}
 }
 
+float AGGJCharacter::DrainMaskDuration(float Duration, float& InOutDrainRateMultiplier, float DrainIncreaseRate)
+{
+	// Decrease duration by 1 second, scaled by the current drain multiplier
+	Duration -= (1.0f * InOutDrainRateMultiplier);
+
+	// Increase the drain rate for the next second, making it harder to maintain
+	InOutDrainRateMultiplier += DrainIncreaseRate;
+
+	return Duration;
+}
+
 void AGGJCharacter::ExtendMaskDuration()
 {
 	if (CurrentMaskType != EEnemyType::None)
@@ -1201,23 +1293,25 @@ void AGGJCharacter::ExtendMaskDuration()
 
 void AGGJCharacter::ApplyBuff(EEnemyType MaskType)
 {
+	GGJ_COMBAT_EVENT(BuffApplied, this, nullptr, 0.0f, static_cast<uint8>(MaskType));
+	
 	// Placeholder for buff logic
 	switch (MaskType)
 	{
 		case EEnemyType::RedRabbit:
 			bHasLifesteal = true;
 			bExtendsDurationOnHit = true;
-			UE_LOG(LogTemp, Warning, TEXT("Applied Red Rabbit Buff! Lifesteal and Mask Extension on hit enabled."));
+			UE_LOG(LogGGJCombat, Verbose, TEXT("Applied Red Rabbit Buff! Lifesteal and Mask Extension on hit enabled."));
 			break;
 		case EEnemyType::GreenBird:
 			bIsImmuneToKnockdown = true;
 			bHasDamageReduction = true;
-			UE_LOG(LogTemp, Warning, TEXT("Applied Green Bird Buff! Knockdown immunity and Damage Reduction enabled."));
+			UE_LOG(LogGGJCombat, Verbose, TEXT("Applied Green Bird Buff! Knockdown immunity and Damage Reduction enabled."));
 			break;
 		case EEnemyType::BlueCat:
 			RollCooldown = BlueCat_RollCooldown;
 			GetCharacterMovement()->MaxWalkSpeed = BlueCat_MovementSpeed;
-			UE_LOG(LogTemp, Warning, TEXT("Applied Blue Cat Buff! Roll cooldown reduced and movement speed increased."));
+			UE_LOG(LogGGJCombat, Verbose, TEXT("Applied Blue Cat Buff! Roll cooldown reduced and movement speed increased."));
 			break;
 		default: break;
 	}
@@ -1225,23 +1319,25 @@ void AGGJCharacter::ApplyBuff(EEnemyType MaskType)
 
 void AGGJCharacter::RemoveBuff(EEnemyType MaskType)
 {
+	GGJ_COMBAT_EVENT(BuffRemoved, this, nullptr, 0.0f, static_cast<uint8>(MaskType));
+	
 	// Placeholder for removing buff logic
 	switch (MaskType)
 	{
 		case EEnemyType::RedRabbit:
 			bHasLifesteal = false;
 			bExtendsDurationOnHit = false;
-			UE_LOG(LogTemp, Warning, TEXT("Removed Red Rabbit Buff."));
+			UE_LOG(LogGGJCombat, Verbose, TEXT("Removed Red Rabbit Buff."));
 			break;
 		case EEnemyType::GreenBird:
 			bIsImmuneToKnockdown = false;
 			bHasDamageReduction = false;
-			UE_LOG(LogTemp, Warning, TEXT("Removed Green Bird Buff."));
+			UE_LOG(LogGGJCombat, Verbose, TEXT("Removed Green Bird Buff."));
 			break;
 		case EEnemyType::BlueCat:
 			RollCooldown = DefaultRollCooldown;
 			GetCharacterMovement()->MaxWalkSpeed = DefaultMaxWalkSpeed;
-			UE_LOG(LogTemp, Warning, TEXT("Removed Blue Cat Buff."));
+			UE_LOG(LogGGJCombat, Verbose, TEXT("Removed Blue Cat Buff."));
 			break;
 		default: break;
 	}
@@ -1314,6 +1410,8 @@ void AGGJCharacter::StopJumpSequence()
 
 void AGGJCharacter::PerformJump()
 {
+	GGJ_FLIGHT_TIMER(PerformJump);
+
 	Jump();
 	bStartJumping = false;
 
@@ -0,0 +1,59 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Characters/HitboxSweep.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "Game/GGJStats.h"
+
+void FHitboxSweep::Begin(const UPrimitiveComponent* Hitbox)
+{
+	LastLocation = Hitbox->GetComponentLocation();
+	bActive = true;
+	HitActors.Reset();
+}
+
+void FHitboxSweep::End()
+{
+	bActive = false;
+}
+
+void FHitboxSweep::Sweep(UPrimitiveComponent* Hitbox, TArray<FHitResult>& OutHits)
+{
+	OutHits.Reset();
+	if (!bActive || !Hitbox) return;
+
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJHitboxSweep, Combat);
+
+	const FVector Location = Hitbox->GetComponentLocation();
+
+	// Uses the hitbox's own shape and collision profile, so only hurtboxes it overlaps are reported
+	TArray<FHitResult> Hits;
+	FComponentQueryParams Params(SCENE_QUERY_STAT(HitboxSweep), Hitbox->GetOwner());
+	Hitbox->GetWorld()->ComponentSweepMulti(Hits, Hitbox, LastLocation, Location, Hitbox->GetComponentQuat(), Params);
+
+	LastLocation = Location;
+
+	Hits.Sort([](const FHitResult& A, const FHitResult& B) { return A.Time < B.Time; });
+
+	for (const FHitResult& Hit : Hits)
+	{
+		const AActor* Actor = Hit.GetActor();
+		if (!Actor || HitActors.Contains(Actor)) continue;
+
+		const bool bAlreadyReported = OutHits.ContainsByPredicate([Actor](const FHitResult& Other) { return Other.GetActor() == Actor; });
+		if (!bAlreadyReported)
+		{
+			OutHits.Add(Hit);
+		}
+	}
+}
+
+bool FHitboxSweep::MarkHit(const AActor* Actor)
+{
+	if (HitActors.Contains(Actor)) return false;
+
+	HitActors.Add(Actor);
+	return true;
+}
@@ -0,0 +1,158 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/CollisionAudit.h"
+
+#include "EngineUtils.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "Game/GGJStats.h"
+
+FString FCollisionAudit::GetChannelName(ECollisionChannel Channel)
+{
+	return UCollisionProfile::Get()->ReturnChannelNameFromContainerIndex(Channel).ToString();
+}
+
+int32 FCollisionAudit::CountOverlapPairs(const UWorld* World, TArray<FPairCount>& OutCounts)
+{
+	OutCounts.Reset();
+	if (!World) return 0;
+
+	// Key is the sorted object type pair
+	TMap<uint16, int32> Counts;
+	int32 Total = 0;
+
+	TArray<FOverlapResult> Overlaps;
+
+	for (TActorIterator<AActor> It(const_cast<UWorld*>(World)); It; ++It)
+	{
+		TInlineComponentArray<UPrimitiveComponent*> Primitives(*It);
+
+		FComponentQueryParams Params(SCENE_QUERY_STAT(GGJCollisionAudit), *It);
+
+		for (const UPrimitiveComponent* Primitive : Primitives)
+		{
+			if (!Primitive->IsRegistered() || !Primitive->IsQueryCollisionEnabled()) continue;
+
+			// Queried with the component's own object type and responses, so a pair is only found when neither side ignores the other
+			Overlaps.Reset();
+			World->ComponentOverlapMulti(Overlaps, Primitive, Primitive->GetComponentLocation(), Primitive->GetComponentQuat(), Params);
+
+			for (const FOverlapResult& Overlap : Overlaps)
+			{
+				const UPrimitiveComponent* Other = Overlap.GetComponent();
+
+				// Both sides find the pair, count it from one
+				if (!Other || Other < Primitive) continue;
+
+				const uint8 TypeA = Primitive->GetCollisionObjectType();
+				const uint8 TypeB = Other->GetCollisionObjectType();
+				Counts.FindOrAdd(static_cast<uint16>(FMath::Min(TypeA, TypeB)) << 8 | FMath::Max(TypeA, TypeB))++;
+				Total++;
+			}
+		}
+	}
+
+	for (const TPair<uint16, int32>& Pair : Counts)
+	{
+		FPairCount& Count = OutCounts.AddDefaulted_GetRef();
+		Count.A = static_cast<ECollisionChannel>(Pair.Key >> 8);
+		Count.B = static_cast<ECollisionChannel>(Pair.Key & 0xFF);
+		Count.Count = Pair.Value;
+	}
+
+	OutCounts.Sort([](const FPairCount& L, const FPairCount& R) { return L.Count > R.Count; });
+	return Total;
+}
+
+int32 FCollisionAudit::AuditProfiles(const FString& ProfilePrefix, TArray<FString>& OutLines)
+{
+	OutLines.Reset();
+
+	const UCollisionProfile* Profiles = UCollisionProfile::Get();
+	TArray<const FCollisionResponseTemplate*> Templates;
+
+	for (int32 i = 0; i < Profiles->GetNumOfProfiles(); ++i)
+	{
+		const FCollisionResponseTemplate* Template = Profiles->GetProfileByIndex(i);
+		if (Template && Template->CollisionEnabled != ECollisionEnabled::NoCollision && Template->Name.ToString().StartsWith(ProfilePrefix))
+		{
+			Templates.Add(Template);
+		}
+	}
+
+	int32 SelfPairs = 0;
+
+	for (int32 i = 0; i < Templates.Num(); ++i)
+	{
+		for (int32 j = i; j < Templates.Num(); ++j)
+		{
+			const FCollisionResponseTemplate& A = *Templates[i];
+			const FCollisionResponseTemplate& B = *Templates[j];
+
+			// An overlap pair needs both sides to at least overlap the other's object type
+			if (A.ResponseToChannels.GetResponse(B.ObjectType) == ECR_Ignore || B.ResponseToChannels.GetResponse(A.ObjectType) == ECR_Ignore) continue;
+
+			const bool bSelf = A.ObjectType == B.ObjectType;
+			SelfPairs += bSelf ? 1 : 0;
+
+			OutLines.Add(FString::Printf(TEXT("%s%s (%s) <-> %s (%s)"), bSelf ? TEXT("[self] ") : TEXT(""),
+				*A.Name.ToString(), *GetChannelName(A.ObjectType), *B.Name.ToString(), *GetChannelName(B.ObjectType)));
+		}
+	}
+
+	return SelfPairs;
+}
+
+bool FCollisionAudit::IsWithinBudget(const UWorld* World, int32 MaxPairs, int32& OutPairs)
+{
+	TArray<FPairCount> Counts;
+	OutPairs = CountOverlapPairs(World, Counts);
+	return OutPairs <= MaxPairs;
+}
+
+void FCollisionAudit::LogReport(const UWorld* World)
+{
+	TArray<FPairCount> Counts;
+	const int32 Total = CountOverlapPairs(World, Counts);
+
+	UE_LOG(LogGGJCollision, Display, TEXT("Live overlap pairs: %d"), Total);
+	for (const FPairCount& Count : Counts)
+	{
+		UE_LOG(LogGGJCollision, Display, TEXT("  %5d  %s <-> %s"), Count.Count, *GetChannelName(Count.A), *GetChannelName(Count.B));
+	}
+
+	TArray<FString> Lines;
+	const int32 SelfPairs = AuditProfiles(TEXT("GGJ"), Lines);
+
+	UE_LOG(LogGGJCollision, Display, TEXT("Overlapping GGJ profile pairs: %d (%d self)"), Lines.Num(), SelfPairs);
+	for (const FString& Line : Lines)
+	{
+		UE_LOG(LogGGJCollision, Display, TEXT("  %s"), *Line);
+	}
+}
+
+static FAutoConsoleCommandWithWorld GCollisionAuditCommand(
+	TEXT("ggj.Collision.Audit"),
+	TEXT("Log live overlap pairs by object type and the GGJ collision profiles that overlap each other."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&FCollisionAudit::LogReport));
+
+static FAutoConsoleCommandWithWorldAndArgs GCollisionBudgetCommand(
+	TEXT("ggj.Collision.CheckBudget"),
+	TEXT("ggj.Collision.CheckBudget <MaxPairs>: report whether the live overlap pair count is within budget."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 MaxPairs = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 0;
+
+		int32 Pairs = 0;
+		if (FCollisionAudit::IsWithinBudget(World, MaxPairs, Pairs))
+		{
+			UE_LOG(LogGGJCollision, Display, TEXT("Overlap pairs within budget: %d / %d"), Pairs, MaxPairs);
+		}
+		else
+		{
+			UE_LOG(LogGGJCollision, Error, TEXT("Overlap pairs over budget: %d / %d"), Pairs, MaxPairs);
+		}
+	}));
@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/CollisionAuditCommandlet.h"
+
+#include "Debug/CollisionAudit.h"
+#include "Game/GGJStats.h"
+
+UCollisionAuditCommandlet::UCollisionAuditCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UCollisionAuditCommandlet::Main(const FString& Params)
+{
+	FString Prefix = TEXT("GGJ");
+	FParse::Value(*Params, TEXT("Prefix="), Prefix);
+
+	TArray<FString> Lines;
+	const int32 SelfPairs = FCollisionAudit::AuditProfiles(Prefix, Lines);
+
+	UE_LOG(LogGGJCollision, Display, TEXT("Overlapping '%s' profile pairs: %d (%d self)"), *Prefix, Lines.Num(), SelfPairs);
+	for (const FString& Line : Lines)
+	{
+		UE_LOG(LogGGJCollision, Display, TEXT("  %s"), *Line);
+	}
+
+	return SelfPairs > 0 ? 1 : 0;
+}
@@ -0,0 +1,344 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/CombatTelemetry.h"
+
+#include "Debug/SpscRing.h"
+#include "HAL/FileManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGGJCombatTelemetry, Log, All);
+
+namespace GGJCombatTelemetry
+{
+	constexpr uint32 FileMagic = 0x434A4747; // "GGJC"
+	constexpr uint32 FileVersion = 1;
+
+	/** How often the writer drains the ring when the game thread does not wake it. */
+	constexpr uint32 DrainIntervalMs = 20;
+
+	/** Smallest encoded event: type, param, three one-byte varints and the value. */
+	constexpr int32 MinEventSize = 1 + 1 + 3 + sizeof(float);
+
+	using FRing = TGGJSpscRing<FGGJCombatEvent, FGGJCombatTelemetry::RingCapacity>;
+
+	void WriteVarint(TArray<uint8>& Out, uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Out.Add(static_cast<uint8>(Value) | 0x80);
+			Value >>= 7;
+		}
+		Out.Add(static_cast<uint8>(Value));
+	}
+
+	bool ReadVarint(TConstArrayView<uint8> Data, int32& Offset, uint64& OutValue)
+	{
+		OutValue = 0;
+		for (int32 Shift = 0; Shift < 64; Shift += 7)
+		{
+			if (Offset >= Data.Num()) return false;
+
+			const uint8 Byte = Data[Offset++];
+			OutValue |= static_cast<uint64>(Byte & 0x7F) << Shift;
+			if ((Byte & 0x80) == 0) return true;
+		}
+		return false;
+	}
+
+	/** Small signed differences, either way, stay small unsigned numbers. */
+	uint64 ZigZag(int64 Value)
+	{
+		return (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+	}
+
+	int64 UnZigZag(uint64 Value)
+	{
+		return static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1);
+	}
+
+	template <typename T>
+	void WriteRaw(TArray<uint8>& Out, const T& Value)
+	{
+		Out.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+	}
+
+	template <typename T>
+	bool ReadRaw(TConstArrayView<uint8> Data, int32& Offset, T& OutValue)
+	{
+		if (Offset + static_cast<int32>(sizeof(T)) > Data.Num()) return false;
+
+		FMemory::Memcpy(&OutValue, Data.GetData() + Offset, sizeof(T));
+		Offset += sizeof(T);
+		return true;
+	}
+
+	/** Drains the ring into the file on its own thread. */
+	class FWriter : public FRunnable
+	{
+	public:
+		FWriter(FRing& InRing, FArchive* InFile, uint64 StartCycles)
+			: Ring(InRing)
+			, File(InFile)
+		{
+			State.Cycles = StartCycles;
+			WakeEvent = FPlatformProcess::GetSynchEventFromPool();
+		}
+
+		virtual ~FWriter() override
+		{
+			FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		}
+
+		virtual uint32 Run() override
+		{
+			while (!bStopping.load(std::memory_order_acquire))
+			{
+				Drain();
+				WakeEvent->Wait(DrainIntervalMs);
+			}
+
+			// The game thread has stopped pushing by now
+			Drain();
+			return 0;
+		}
+
+		virtual void Stop() override
+		{
+			bStopping.store(true, std::memory_order_release);
+			WakeEvent->Trigger();
+		}
+
+		void Wake()
+		{
+			WakeEvent->Trigger();
+		}
+
+		int64 GetBytesWritten() const { return BytesWritten.load(std::memory_order_relaxed); }
+
+	private:
+		void Drain()
+		{
+			FGGJCombatEvent Event;
+			while (Ring.Pop(Event))
+			{
+				FGGJCombatTelemetry::EncodeEvent(Event, State, Buffer);
+			}
+			if (Buffer.Num() == 0) return;
+
+			File->Serialize(Buffer.GetData(), Buffer.Num());
+			BytesWritten.fetch_add(Buffer.Num(), std::memory_order_relaxed);
+			Buffer.Reset();
+		}
+
+		FRing& Ring;
+		FArchive* File;
+		FEvent* WakeEvent = nullptr;
+		FGGJCombatTelemetry::FEncoderState State;
+		TArray<uint8> Buffer;
+		std::atomic<bool> bStopping{false};
+		std::atomic<int64> BytesWritten{0};
+	};
+
+	TUniquePtr<FRing> Ring;
+	TUniquePtr<FArchive> File;
+	TUniquePtr<FWriter> Writer;
+	FRunnableThread* Thread = nullptr;
+	FString FilePath;
+	int32 NumRecorded = 0;
+	std::atomic<int32> NumDropped{0};
+}
+
+bool FGGJCombatTelemetry::bRecording = false;
+
+void FGGJCombatTelemetry::Start()
+{
+	using namespace GGJCombatTelemetry;
+
+	check(IsInGameThread());
+	if (bRecording) return;
+
+	if (!FPlatformProcess::SupportsMultithreading())
+	{
+		UE_LOG(LogGGJCombatTelemetry, Warning, TEXT("Combat telemetry needs a writer thread, not recording."));
+		return;
+	}
+
+	FilePath = GetTelemetryDir() / FString::Printf(TEXT("Combat-%s.ggjc"), *FDateTime::Now().ToString());
+	File.Reset(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!File)
+	{
+		UE_LOG(LogGGJCombatTelemetry, Error, TEXT("Could not create '%s'"), *FilePath);
+		return;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	TArray<uint8> Header;
+	WriteHeader(Header, FPlatformTime::GetSecondsPerCycle64(), StartCycles);
+	File->Serialize(Header.GetData(), Header.Num());
+
+	if (!Ring) Ring = MakeUnique<FRing>();
+	NumRecorded = 0;
+	NumDropped.store(0);
+
+	Writer = MakeUnique<FWriter>(*Ring, File.Get(), StartCycles);
+	Thread = FRunnableThread::Create(Writer.Get(), TEXT("GGJCombatTelemetry"), 0, TPri_BelowNormal);
+	bRecording = true;
+
+	UE_LOG(LogGGJCombatTelemetry, Log, TEXT("Recording combat telemetry to %s"), *FilePath);
+}
+
+void FGGJCombatTelemetry::Stop()
+{
+	using namespace GGJCombatTelemetry;
+
+	check(IsInGameThread());
+	if (!bRecording) return;
+
+	bRecording = false;
+
+	// Kill waits for Run to return, which drains the ring one last time
+	Thread->Kill(true);
+	delete Thread;
+	Thread = nullptr;
+
+	const int64 BytesWritten = Writer->GetBytesWritten();
+	Writer.Reset();
+	File->Close();
+	File.Reset();
+
+	UE_LOG(LogGGJCombatTelemetry, Log, TEXT("Wrote %d combat events (%d dropped, %.1f bytes per event) to %s"),
+		NumRecorded, NumDropped.load(), NumRecorded > 0 ? static_cast<double>(BytesWritten) / NumRecorded : 0.0, *FilePath);
+}
+
+void FGGJCombatTelemetry::Record(EGGJCombatEvent Type, const UObject* Source, const UObject* Target, float Value, uint8 Param)
+{
+	using namespace GGJCombatTelemetry;
+
+	if (!bRecording) return;
+	if (!IsInGameThread())
+	{
+		NumDropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	FGGJCombatEvent Event;
+	Event.Cycles = FPlatformTime::Cycles64();
+	Event.SourceId = Source ? Source->GetUniqueID() : 0;
+	Event.TargetId = Target ? Target->GetUniqueID() : 0;
+	Event.Value = Value;
+	Event.Type = Type;
+	Event.Param = Param;
+
+	if (!Ring->Push(Event))
+	{
+		NumDropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	++NumRecorded;
+
+	// Only wake the writer early in a burst, it polls otherwise
+	if (Ring->Num() == RingCapacity / 2) Writer->Wake();
+}
+
+int32 FGGJCombatTelemetry::GetNumDropped()
+{
+	return GGJCombatTelemetry::NumDropped.load(std::memory_order_relaxed);
+}
+
+FString FGGJCombatTelemetry::GetTelemetryDir()
+{
+	return FPaths::ProfilingDir() / TEXT("GGJCombat");
+}
+
+void FGGJCombatTelemetry::WriteHeader(TArray<uint8>& Out, double SecondsPerCycle, uint64 StartCycles)
+{
+	using namespace GGJCombatTelemetry;
+
+	WriteRaw(Out, FileMagic);
+	WriteRaw(Out, FileVersion);
+	WriteRaw(Out, SecondsPerCycle);
+	WriteRaw(Out, StartCycles);
+}
+
+void FGGJCombatTelemetry::EncodeEvent(const FGGJCombatEvent& Event, FEncoderState& State, TArray<uint8>& Out)
+{
+	using namespace GGJCombatTelemetry;
+
+	Out.Add(static_cast<uint8>(Event.Type));
+	Out.Add(Event.Param);
+	WriteVarint(Out, Event.Cycles - State.Cycles);
+	WriteVarint(Out, ZigZag(static_cast<int64>(Event.SourceId) - State.SourceId));
+	WriteVarint(Out, ZigZag(static_cast<int64>(Event.TargetId) - State.TargetId));
+	WriteRaw(Out, Event.Value);
+
+	State.Cycles = Event.Cycles;
+	State.SourceId = Event.SourceId;
+	State.TargetId = Event.TargetId;
+}
+
+bool FGGJCombatTelemetry::Decode(TConstArrayView<uint8> Data, FGGJCombatTelemetryFile& OutFile)
+{
+	using namespace GGJCombatTelemetry;
+
+	OutFile = FGGJCombatTelemetryFile();
+
+	int32 Offset = 0;
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	if (!ReadRaw(Data, Offset, Magic) || Magic != FileMagic) return false;
+	if (!ReadRaw(Data, Offset, Version) || Version != FileVersion) return false;
+	if (!ReadRaw(Data, Offset, OutFile.SecondsPerCycle) || !ReadRaw(Data, Offset, OutFile.StartCycles)) return false;
+
+	OutFile.Events.Reserve((Data.Num() - Offset) / MinEventSize);
+
+	FEncoderState State;
+	State.Cycles = OutFile.StartCycles;
+	while (Offset < Data.Num())
+	{
+		FGGJCombatEvent Event;
+		uint8 Type = 0;
+		uint64 CycleDelta = 0;
+		uint64 SourceDelta = 0;
+		uint64 TargetDelta = 0;
+		if (!ReadRaw(Data, Offset, Type)
+			|| !ReadRaw(Data, Offset, Event.Param)
+			|| !ReadVarint(Data, Offset, CycleDelta)
+			|| !ReadVarint(Data, Offset, SourceDelta)
+			|| !ReadVarint(Data, Offset, TargetDelta)
+			|| !ReadRaw(Data, Offset, Event.Value))
+		{
+			return false;
+		}
+
+		Event.Type = static_cast<EGGJCombatEvent>(Type);
+		Event.Cycles = State.Cycles + CycleDelta;
+		Event.SourceId = static_cast<uint32>(State.SourceId + UnZigZag(SourceDelta));
+		Event.TargetId = static_cast<uint32>(State.TargetId + UnZigZag(TargetDelta));
+
+		State.Cycles = Event.Cycles;
+		State.SourceId = Event.SourceId;
+		State.TargetId = Event.TargetId;
+		OutFile.Events.Add(Event);
+	}
+	return true;
+}
+
+bool FGGJCombatTelemetry::LoadFile(const FString& Path, FGGJCombatTelemetryFile& OutFile)
+{
+	TArray<uint8> Data;
+	return FFileHelper::LoadFileToArray(Data, *Path) && Decode(Data, OutFile);
+}
+
+static FAutoConsoleCommand GCombatTelemetryStartCommand(
+	TEXT("ggj.CombatTelemetry.Start"),
+	TEXT("Start recording combat events to Saved/Profiling/GGJCombat."),
+	FConsoleCommandDelegate::CreateStatic(&FGGJCombatTelemetry::Start));
+
+static FAutoConsoleCommand GCombatTelemetryStopCommand(
+	TEXT("ggj.CombatTelemetry.Stop"),
+	TEXT("Stop recording combat events and close the file."),
+	FConsoleCommandDelegate::CreateStatic(&FGGJCombatTelemetry::Stop));
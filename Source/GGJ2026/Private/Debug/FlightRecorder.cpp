@@ -0,0 +1,348 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/FlightRecorder.h"
+
+#include "Engine/World.h"
+#include "Game/GGJStats.h"
+#include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace GGJFlightRecorder
+{
+	constexpr uint32 FileMagic = 0x464A4747; // "GGJF"
+	constexpr uint32 FileVersion = 1;
+
+	int32 Enabled = 1;
+	float HitchMs = 50.0f;
+	int32 DumpFrames = 60;
+	float DumpCooldown = 5.0f;
+	int32 MaxDumps = 16;
+
+	/** Frame bounds as sequence numbers into the event ring. */
+	struct FFrameMark
+	{
+		uint64 FrameNumber = 0;
+		uint64 StartCycles = 0;
+		uint64 EndCycles = 0;
+		uint64 FirstEvent = 0;
+		uint64 EndEvent = 0;
+	};
+
+	FGGJFlightEvent Events[FGGJFlightRecorder::EventCapacity];
+	FFrameMark Frames[FGGJFlightRecorder::FrameCapacity];
+
+	uint64 EventSeq = 0;
+	uint64 FrameSeq = 0;
+	FFrameMark CurrentFrame;
+
+	bool bInstalled = false;
+	double LastDumpTime = -DBL_MAX;
+	int32 NumDumps = 0;
+}
+
+static FAutoConsoleVariableRef CVarFlightRecorderEnable(
+	TEXT("ggj.FlightRecorder.Enable"),
+	GGJFlightRecorder::Enabled,
+	TEXT("Record gameplay events for hitch dumps."));
+
+static FAutoConsoleVariableRef CVarFlightRecorderHitchMs(
+	TEXT("ggj.FlightRecorder.HitchMs"),
+	GGJFlightRecorder::HitchMs,
+	TEXT("Frames longer than this are dumped. 0 disables automatic dumps."));
+
+static FAutoConsoleVariableRef CVarFlightRecorderDumpFrames(
+	TEXT("ggj.FlightRecorder.DumpFrames"),
+	GGJFlightRecorder::DumpFrames,
+	TEXT("Frames written per dump, up to the hitch frame."));
+
+static FAutoConsoleVariableRef CVarFlightRecorderDumpCooldown(
+	TEXT("ggj.FlightRecorder.DumpCooldown"),
+	GGJFlightRecorder::DumpCooldown,
+	TEXT("Minimum seconds between automatic dumps, so a slow stretch does not write a file per frame."));
+
+static FAutoConsoleVariableRef CVarFlightRecorderMaxDumps(
+	TEXT("ggj.FlightRecorder.MaxDumps"),
+	GGJFlightRecorder::MaxDumps,
+	TEXT("Automatic dumps per session."));
+
+static FAutoConsoleCommand GFlightRecorderDumpCommand(
+	TEXT("ggj.FlightRecorder.Dump"),
+	TEXT("Write the recent frames to Saved/Profiling/GGJFlight now."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		const FString Path = FGGJFlightRecorder::Dump(GGJFlightRecorder::DumpFrames);
+		UE_LOG(LogGGJFlightRecorder, Display, TEXT("Flight recorder dump: %s"), Path.IsEmpty() ? TEXT("failed") : *Path);
+	}));
+
+void FGGJFlightRecorder::Install()
+{
+	using namespace GGJFlightRecorder;
+
+	check(IsInGameThread());
+	if (bInstalled) return;
+	bInstalled = true;
+
+	FCoreDelegates::OnBeginFrame.AddStatic(&FGGJFlightRecorder::OnBeginFrame);
+	FCoreDelegates::OnEndFrame.AddStatic(&FGGJFlightRecorder::OnEndFrame);
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddLambda([]() { Record(EGGJFlightEvent::GCBegin, NAME_None); });
+	FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([]() { Record(EGGJFlightEvent::GCEnd, NAME_None); });
+
+	CurrentFrame.FrameNumber = GFrameCounter;
+	CurrentFrame.StartCycles = FPlatformTime::Cycles64();
+	CurrentFrame.FirstEvent = EventSeq;
+}
+
+void FGGJFlightRecorder::Record(EGGJFlightEvent Type, FName Subject, FName Detail, float Value)
+{
+	using namespace GGJFlightRecorder;
+
+	if (!Enabled || !IsInGameThread()) return;
+
+	FGGJFlightEvent& Event = Events[EventSeq++ % EventCapacity];
+	Event.Cycles = FPlatformTime::Cycles64();
+	Event.Subject = Subject;
+	Event.Detail = Detail;
+	Event.Value = Value;
+	Event.Type = Type;
+}
+
+void FGGJFlightRecorder::OnBeginFrame()
+{
+	GGJFlightRecorder::CurrentFrame.FrameNumber = GFrameCounter;
+	GGJFlightRecorder::CurrentFrame.StartCycles = FPlatformTime::Cycles64();
+}
+
+void FGGJFlightRecorder::OnEndFrame()
+{
+	using namespace GGJFlightRecorder;
+
+	if (!Enabled) return;
+
+	// Events between the end of one frame and the start of the next belong to the next one
+	CurrentFrame.EndCycles = FPlatformTime::Cycles64();
+	CurrentFrame.EndEvent = EventSeq;
+	Frames[FrameSeq++ % FrameCapacity] = CurrentFrame;
+	CurrentFrame.FirstEvent = EventSeq;
+
+	const double FrameMs = FPlatformTime::ToMilliseconds64(CurrentFrame.EndCycles - CurrentFrame.StartCycles);
+	if (HitchMs <= 0.0f || FrameMs <= HitchMs || NumDumps >= MaxDumps) return;
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastDumpTime < DumpCooldown) return;
+
+	LastDumpTime = Now;
+	NumDumps++;
+
+	const FString Path = Dump(DumpFrames);
+	UE_LOG(LogGGJFlightRecorder, Warning, TEXT("Hitch of %.1f ms on frame %llu, flight recorder dump: %s"), FrameMs, CurrentFrame.FrameNumber, *Path);
+}
+
+void FGGJFlightRecorder::GetRecentFrames(int32 NumFrames, TArray<FGGJFlightFrame>& OutFrames)
+{
+	using namespace GGJFlightRecorder;
+
+	const uint64 Available = FMath::Min<uint64>(FrameSeq, FrameCapacity);
+	const uint64 Count = FMath::Min<uint64>(Available, FMath::Max(NumFrames, 1));
+	const uint64 OldestEvent = EventSeq > EventCapacity ? EventSeq - EventCapacity : 0;
+
+	for (uint64 Seq = FrameSeq - Count; Seq < FrameSeq; ++Seq)
+	{
+		const FFrameMark& Mark = Frames[Seq % FrameCapacity];
+
+		// Partly overwritten by newer events
+		if (Mark.FirstEvent < OldestEvent) continue;
+
+		FGGJFlightFrame& Frame = OutFrames.AddDefaulted_GetRef();
+		Frame.FrameNumber = Mark.FrameNumber;
+		Frame.StartCycles = Mark.StartCycles;
+		Frame.EndCycles = Mark.EndCycles;
+		Frame.Events.Reserve(Mark.EndEvent - Mark.FirstEvent);
+		for (uint64 EventIndex = Mark.FirstEvent; EventIndex < Mark.EndEvent; ++EventIndex)
+		{
+			Frame.Events.Add(Events[EventIndex % EventCapacity]);
+		}
+	}
+}
+
+FString FGGJFlightRecorder::Dump(int32 NumFrames)
+{
+	check(IsInGameThread());
+
+	TArray<FGGJFlightFrame> RecentFrames;
+	GetRecentFrames(NumFrames, RecentFrames);
+
+	// Name table, indices are written in place of FNames
+	TMap<FName, int32> NameIndices;
+	TArray<FString> Names;
+	auto IndexOf = [&NameIndices, &Names](FName Name)
+	{
+		if (Name.IsNone()) return int32(INDEX_NONE);
+		if (const int32* Index = NameIndices.Find(Name)) return *Index;
+		Names.Add(Name.ToString());
+		return NameIndices.Add(Name, Names.Num() - 1);
+	};
+
+	for (const FGGJFlightFrame& Frame : RecentFrames)
+	{
+		for (const FGGJFlightEvent& Event : Frame.Events)
+		{
+			IndexOf(Event.Subject);
+			IndexOf(Event.Detail);
+		}
+	}
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+
+	uint32 Magic = GGJFlightRecorder::FileMagic;
+	uint32 Version = GGJFlightRecorder::FileVersion;
+	double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+	float ThresholdMs = GGJFlightRecorder::HitchMs;
+	FString BuildVersion = FApp::GetBuildVersion();
+	Writer << Magic << Version << SecondsPerCycle << ThresholdMs << BuildVersion << Names;
+
+	int32 NumWritten = RecentFrames.Num();
+	Writer << NumWritten;
+	for (FGGJFlightFrame& Frame : RecentFrames)
+	{
+		int32 NumEvents = Frame.Events.Num();
+		Writer << Frame.FrameNumber << Frame.StartCycles << Frame.EndCycles << NumEvents;
+
+		for (FGGJFlightEvent& Event : Frame.Events)
+		{
+			uint8 Type = static_cast<uint8>(Event.Type);
+			int32 Subject = IndexOf(Event.Subject);
+			int32 Detail = IndexOf(Event.Detail);
+			Writer << Event.Cycles << Type << Subject << Detail << Event.Value;
+		}
+	}
+
+	const uint64 LastFrame = RecentFrames.Num() > 0 ? RecentFrames.Last().FrameNumber : GFrameCounter;
+	const FString Path = GetDumpDir() / FString::Printf(TEXT("Hitch-%s-%llu.ggjflight"), *FDateTime::Now().ToString(), LastFrame);
+
+	return FFileHelper::SaveArrayToFile(Data, *Path) ? Path : FString();
+}
+
+bool FGGJFlightRecorder::LoadDump(const FString& Path, FGGJFlightDump& OutDump)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Path)) return false;
+
+	FMemoryReader Reader(Data);
+
+	uint32 Magic = 0, Version = 0;
+	Reader << Magic << Version;
+	if (Magic != GGJFlightRecorder::FileMagic || Version != GGJFlightRecorder::FileVersion) return false;
+
+	Reader << OutDump.SecondsPerCycle << OutDump.ThresholdMs << OutDump.BuildVersion << OutDump.Names;
+
+	int32 NumFrames = 0;
+	Reader << NumFrames;
+	if (Reader.IsError() || NumFrames < 0) return false;
+
+	OutDump.Frames.SetNum(NumFrames);
+	for (FGGJFlightDump::FFrame& Frame : OutDump.Frames)
+	{
+		int32 NumEvents = 0;
+		Reader << Frame.FrameNumber << Frame.StartCycles << Frame.EndCycles << NumEvents;
+		if (Reader.IsError() || NumEvents < 0) return false;
+
+		Frame.Events.SetNum(NumEvents);
+		for (FGGJFlightDump::FEvent& Event : Frame.Events)
+		{
+			uint8 Type = 0;
+			Reader << Event.Cycles << Type << Event.Subject << Event.Detail << Event.Value;
+			Event.Type = static_cast<EGGJFlightEvent>(Type);
+		}
+	}
+
+	return !Reader.IsError();
+}
+
+void FGGJFlightRecorder::FormatTimeline(const FGGJFlightDump& Dump, TArray<FString>& OutLines)
+{
+	if (Dump.Frames.Num() == 0) return;
+
+	const uint64 BaseCycles = Dump.Frames[0].StartCycles;
+	auto ToMs = [&Dump, BaseCycles](uint64 Cycles) { return (static_cast<double>(Cycles) - static_cast<double>(BaseCycles)) * Dump.SecondsPerCycle * 1000.0; };
+	auto NameOf = [&Dump](int32 Index) { return Dump.Names.IsValidIndex(Index) ? *Dump.Names[Index] : TEXT("-"); };
+
+	for (const FGGJFlightDump::FFrame& Frame : Dump.Frames)
+	{
+		const double FrameMs = (Frame.EndCycles - Frame.StartCycles) * Dump.SecondsPerCycle * 1000.0;
+		OutLines.Add(FString::Printf(TEXT("Frame %llu at %.3f ms: %.2f ms%s"), Frame.FrameNumber, ToMs(Frame.StartCycles), FrameMs,
+			FrameMs > Dump.ThresholdMs ? TEXT("  <-- HITCH") : TEXT("")));
+
+		for (const FGGJFlightDump::FEvent& Event : Frame.Events)
+		{
+			OutLines.Add(FString::Printf(TEXT("    %10.3f  %-12s %-32s %-32s %g"), ToMs(Event.Cycles), GetEventName(Event.Type),
+				NameOf(Event.Subject), NameOf(Event.Detail), Event.Value));
+		}
+	}
+}
+
+const TCHAR* FGGJFlightRecorder::GetEventName(EGGJFlightEvent Type)
+{
+	switch (Type)
+	{
+	case EGGJFlightEvent::Spawn:		return TEXT("Spawn");
+	case EGGJFlightEvent::Destroy:		return TEXT("Destroy");
+	case EGGJFlightEvent::Damage:		return TEXT("Damage");
+	case EGGJFlightEvent::StateChange:	return TEXT("State");
+	case EGGJFlightEvent::TimerFire:	return TEXT("Timer");
+	case EGGJFlightEvent::GCBegin:		return TEXT("GCBegin");
+	case EGGJFlightEvent::GCEnd:		return TEXT("GCEnd");
+	default:							return TEXT("Unknown");
+	}
+}
+
+FString FGGJFlightRecorder::GetDumpDir()
+{
+	return FPaths::ProfilingDir() / TEXT("GGJFlight");
+}
+
+bool UFlightRecorderSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return !UE_BUILD_SHIPPING && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool UFlightRecorderSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFlightRecorderSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FGGJFlightRecorder::Install();
+
+	UWorld* World = GetWorld();
+	ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UFlightRecorderSubsystem::OnActorSpawned));
+	ActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &UFlightRecorderSubsystem::OnActorDestroyed));
+}
+
+void UFlightRecorderSubsystem::Deinitialize()
+{
+	UWorld* World = GetWorld();
+	World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	World->RemoveOnActorDestroyedHandler(ActorDestroyedHandle);
+
+	Super::Deinitialize();
+}
+
+void UFlightRecorderSubsystem::OnActorSpawned(AActor* Actor)
+{
+	FGGJFlightRecorder::Record(EGGJFlightEvent::Spawn, Actor->GetFName(), Actor->GetClass()->GetFName());
+}
+
+void UFlightRecorderSubsystem::OnActorDestroyed(AActor* Actor)
+{
+	FGGJFlightRecorder::Record(EGGJFlightEvent::Destroy, Actor->GetFName(), Actor->GetClass()->GetFName());
+}
@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/FlightRecorderCommandlet.h"
+
+#include "Debug/FlightRecorder.h"
+#include "Game/GGJStats.h"
+#include "HAL/FileManager.h"
+
+UFlightRecorderCommandlet::UFlightRecorderCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UFlightRecorderCommandlet::Main(const FString& Params)
+{
+	FString Path;
+	if (!FParse::Value(*Params, TEXT("File="), Path))
+	{
+		TArray<FString> Files;
+		const FString Dir = FGGJFlightRecorder::GetDumpDir();
+		IFileManager::Get().FindFiles(Files, *(Dir / TEXT("*.ggjflight")), true, false);
+
+		// Newest by timestamp
+		FDateTime Newest = FDateTime::MinValue();
+		for (const FString& File : Files)
+		{
+			const FDateTime Stamp = IFileManager::Get().GetTimeStamp(*(Dir / File));
+			if (Stamp > Newest)
+			{
+				Newest = Stamp;
+				Path = Dir / File;
+			}
+		}
+	}
+
+	FGGJFlightDump Dump;
+	if (Path.IsEmpty() || !FGGJFlightRecorder::LoadDump(Path, Dump))
+	{
+		UE_LOG(LogGGJFlightRecorder, Error, TEXT("Could not read flight recorder dump '%s'"), *Path);
+		return 1;
+	}
+
+	UE_LOG(LogGGJFlightRecorder, Display, TEXT("%s: %d frames, hitch threshold %.1f ms, build %s"), *Path, Dump.Frames.Num(), Dump.ThresholdMs, *Dump.BuildVersion);
+
+	TArray<FString> Lines;
+	FGGJFlightRecorder::FormatTimeline(Dump, Lines);
+	for (const FString& Line : Lines)
+	{
+		UE_LOG(LogGGJFlightRecorder, Display, TEXT("%s"), *Line);
+	}
+
+	return 0;
+}
@@ -0,0 +1,165 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/GameplayDebuggerCategory_GGJ.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+#include "BrainComponent.h"
+#include "AI/EnemyManager.h"
+#include "AI/EnemySpawnerManager.h"
+#include "Animation/EnemyAnimBudgetSubsystem.h"
+#include "Characters/EnemyCharacter.h"
+#include "Characters/GGJCharacter.h"
+#include "Components/BoxComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+
+FGameplayDebuggerCategory_GGJ::FGameplayDebuggerCategory_GGJ()
+{
+	bShowOnlyWithDebugActor = false;
+	SetDataPackReplication<FRepData>(&DataPack);
+}
+
+TSharedRef<FGameplayDebuggerCategory> FGameplayDebuggerCategory_GGJ::MakeInstance()
+{
+	return MakeShareable(new FGameplayDebuggerCategory_GGJ());
+}
+
+void FGameplayDebuggerCategory_GGJ::FRepData::Serialize(FArchive& Ar)
+{
+	Ar << ActorName;
+	Ar << Lines;
+}
+
+void FGameplayDebuggerCategory_GGJ::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
+{
+	DataPack.ActorName.Reset();
+	DataPack.Lines.Reset();
+
+	if (const AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(DebugActor))
+	{
+		CollectEnemy(Enemy);
+	}
+	else if (const AGGJCharacter* Player = Cast<AGGJCharacter>(DebugActor ? DebugActor : OwnerPC ? OwnerPC->GetPawn() : nullptr))
+	{
+		CollectPlayer(Player);
+	}
+
+	if (UWorld* World = OwnerPC ? OwnerPC->GetWorld() : nullptr) CollectWorld(World);
+}
+
+void FGameplayDebuggerCategory_GGJ::CollectEnemy(const AEnemyCharacter* Enemy)
+{
+	UWorld* World = Enemy->GetWorld();
+	DataPack.ActorName = Enemy->GetName();
+
+	const bool bDead = Enemy->HealthComp && Enemy->HealthComp->IsActorDead();
+	DataPack.Lines.Add(FString::Printf(TEXT("{yellow}State: {white}%s%s%s"),
+		bDead ? TEXT("Dead") : Enemy->IsAttacking ? TEXT("Attacking") : TEXT("Moving"),
+		Enemy->IsReset ? TEXT(", reset") : TEXT(""),
+		Enemy->bDrivenByFramePipeline ? TEXT(", frame pipeline") : TEXT("")));
+
+	const UEnemyAttackManager* AttackManager = World->GetSubsystem<UEnemyAttackManager>();
+	DataPack.Lines.Add(FString::Printf(TEXT("{yellow}Token: {white}%s"),
+		AttackManager && AttackManager->HasToken(const_cast<AEnemyCharacter*>(Enemy)) ? TEXT("{green}held") : TEXT("none")));
+
+	const UEnemySpawnerManager* Spawner = World->GetSubsystem<UEnemySpawnerManager>();
+	// Active until ResetEnemy, dying enemies included. Enemies placed in the level are not the spawner's.
+	DataPack.Lines.Add(FString::Printf(TEXT("{yellow}Spawner: {white}%s, archetype %d"),
+		Spawner && Spawner->IsActiveEnemy(Enemy) ? TEXT("active") : TEXT("{orange}not tracked"),
+		Enemy->GetArchetypeIndex()));
+
+	// Each line names what it reports, there is no single AI LOD tier
+	const UEnemyAnimBudgetSubsystem* AnimBudget = World->GetSubsystem<UEnemyAnimBudgetSubsystem>();
+	const TCHAR* AnimTier = !AnimBudget || !AnimBudget->IsRegistered(Enemy) ? TEXT("engine tick")
+		: AnimBudget->IsFrozen(Enemy) ? TEXT("frozen")
+		: Enemy->IsAttacking ? TEXT("full rate")
+		: TEXT("budgeted");
+	DataPack.Lines.Add(FString::Printf(TEXT("{yellow}Anim budget: {white}%s"), AnimTier));
+
+	const UBrainComponent* Brain = Enemy->AIController ? Enemy->AIController->GetBrainComponent() : nullptr;
+	DataPack.Lines.Add(FString::Printf(TEXT("{yellow}Movement: {white}%s, {yellow}BT: {white}%s"),
+		Enemy->bLightweightMovementActive ? TEXT("lightweight") : TEXT("character"),
+		Brain && Brain->IsRunning() ? TEXT("running") : TEXT("stopped")));
+
+	DataPack.Lines.Add(FString::Printf(TEXT("{yellow}Hitbox: {white}%s%s"),
+		Enemy->HitboxSweep.IsActive() ? TEXT("{red}active") : TEXT("inactive"),
+		Enemy->bHasHitPlayer ? TEXT(", hit player") : TEXT("")));
+	if (Enemy->HitboxSweep.IsActive()) AddHitboxShape(Enemy->HitboxComponent, Enemy->GetName());
+}
+
+void FGameplayDebuggerCategory_GGJ::CollectPlayer(const AGGJCharacter* Player)
+{
+	const FTimerManager& TimerManager = Player->GetWorldTimerManager();
+	DataPack.ActorName = Player->GetName();
+
+	DataPack.Lines.Add(FString::Printf(TEXT("{yellow}State: {white}%s%s, combo %d, hits %d"),
+		*StaticEnum<ECharacterActionState>()->GetNameStringByValue(static_cast<int64>(Player->ActionState)),
+		Player->bIsInvincible ? TEXT(" {cyan}invincible{white}") : TEXT(""),
+		Player->AttackComboIndex,
+		Player->CurrentHitCount));
+
+	DataPack.Lines.Add(FString::Printf(TEXT("{yellow}Mask: {white}%s, %.1f s"),
+		*StaticEnum<EEnemyType>()->GetNameStringByValue(static_cast<int64>(Player->CurrentMaskType)),
+		Player->CurrentMaskDuration));
+
+	const TPair<const TCHAR*, const FTimerHandle*> Timers[] = {
+		{ TEXT("Combo"), &Player->ComboTimerHandle },
+		{ TEXT("Jump"), &Player->JumpTimerHandle },
+		{ TEXT("Invincibility"), &Player->InvincibilityTimerHandle },
+		{ TEXT("Stun"), &Player->StunTimerHandle },
+		{ TEXT("RollCooldown"), &Player->RollCooldownTimerHandle },
+		{ TEXT("MaskDuration"), &Player->MaskDurationTimerHandle },
+		{ TEXT("HitCountReset"), &Player->HitCountResetTimerHandle },
+		{ TEXT("Grounded"), &Player->GroundedTimerHandle },
+		{ TEXT("TimeDilation"), &Player->TimeDilationTimerHandle },
+	};
+
+	FString ActiveTimers;
+	for (const TPair<const TCHAR*, const FTimerHandle*>& Timer : Timers)
+	{
+		if (!TimerManager.IsTimerActive(*Timer.Value)) continue;
+
+		ActiveTimers += FString::Printf(TEXT("%s%s %.2fs"), ActiveTimers.IsEmpty() ? TEXT("") : TEXT(", "), Timer.Key, TimerManager.GetTimerRemaining(*Timer.Value));
+	}
+	DataPack.Lines.Add(FString::Printf(TEXT("{yellow}Timers: {white}%s"), ActiveTimers.IsEmpty() ? TEXT("none") : *ActiveTimers));
+
+	DataPack.Lines.Add(FString::Printf(TEXT("{yellow}Hitbox: {white}%s"),
+		Player->HitboxSweep.IsActive() ? *FString::Printf(TEXT("{red}active{white}, damage index %d"), Player->HitboxDamageIndex) : TEXT("inactive")));
+	if (Player->HitboxSweep.IsActive()) AddHitboxShape(Player->HitboxComponent, Player->GetName());
+}
+
+void FGameplayDebuggerCategory_GGJ::CollectWorld(UWorld* World)
+{
+	if (const UEnemyAttackManager* AttackManager = World->GetSubsystem<UEnemyAttackManager>())
+	{
+		DataPack.Lines.Add(FString::Printf(TEXT("{yellow}Tokens: {white}%d / %d"), AttackManager->GetNumTokenHolders(), AttackManager->GetMaxTokens()));
+	}
+
+	if (const UEnemySpawnerManager* Spawner = World->GetSubsystem<UEnemySpawnerManager>())
+	{
+		const float NextSpawn = Spawner->GetTimeUntilNextSpawn();
+		DataPack.Lines.Add(FString::Printf(TEXT("{yellow}Enemies: {white}%d active / %d max, pooled %s, %d spawned, next spawn %s"),
+			Spawner->GetNumActiveEnemies(), Spawner->GetMaxEnemies(),
+			Spawner->HasPool() ? *FString::FromInt(Spawner->GetNumPooled()) : TEXT("n/a"), Spawner->GetNumSpawned(),
+			NextSpawn >= 0.0f ? *FString::Printf(TEXT("%.1fs"), NextSpawn) : TEXT("off")));
+	}
+}
+
+void FGameplayDebuggerCategory_GGJ::AddHitboxShape(const UBoxComponent* Hitbox, const FString& Description)
+{
+	if (!Hitbox) return;
+
+	AddShape(FGameplayDebuggerShape::MakeBox(Hitbox->GetComponentLocation(), Hitbox->GetScaledBoxExtent(), FColor::Red, Description));
+}
+
+void FGameplayDebuggerCategory_GGJ::DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext)
+{
+	if (!DataPack.ActorName.IsEmpty()) CanvasContext.Printf(TEXT("{green}%s"), *DataPack.ActorName);
+
+	for (const FString& Line : DataPack.Lines)
+	{
+		CanvasContext.Print(Line);
+	}
+}
+#endif
@@ -0,0 +1,357 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/Heatmap.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Game/GGJStats.h"
+#include "ImageCore.h"
+#include "ImageUtils.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace GGJHeatmap
+{
+	constexpr uint32 FileMagic = 0x484A4747; // "GGJH"
+	constexpr uint32 FileVersion = 1;
+
+	/** Largest image side; bigger layers are cropped around their centre. */
+	constexpr int32 MaxImageSize = 4096;
+
+	/** Seconds between background tasks binning the ring into the grids. */
+	constexpr float DrainInterval = 0.5f;
+
+	int32 Enable = 0;
+	float CellSize = 100.0f;
+	float SampleInterval = 0.25f;
+
+	uint32 ZigZag(int32 Value)
+	{
+		return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+	}
+
+	int32 UnZigZag(uint32 Value)
+	{
+		return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1);
+	}
+
+	FColor GetHeatColor(float Alpha)
+	{
+		// Black to red over the first half, red to yellow to white over the second
+		const FLinearColor Color = Alpha < 0.5f
+			? FLinearColor(Alpha * 2.0f, 0.0f, 0.0f)
+			: FLinearColor(1.0f, FMath::Min(1.0f, (Alpha - 0.5f) * 3.0f), FMath::Max(0.0f, Alpha - 0.8f) * 5.0f);
+		return Color.ToFColor(true);
+	}
+}
+
+static FAutoConsoleVariableRef CVarHeatmapEnable(
+	TEXT("ggj.Heatmap.Enable"),
+	GGJHeatmap::Enable,
+	TEXT("Record heatmaps of player positions, enemy deaths, player hits and mask throws. Read when a world is created."));
+
+static FAutoConsoleVariableRef CVarHeatmapCellSize(
+	TEXT("ggj.Heatmap.CellSize"),
+	GGJHeatmap::CellSize,
+	TEXT("Edge length of a heatmap cell in world units, for matches started afterwards."));
+
+static FAutoConsoleVariableRef CVarHeatmapSampleInterval(
+	TEXT("ggj.Heatmap.SampleInterval"),
+	GGJHeatmap::SampleInterval,
+	TEXT("Seconds between player position samples."));
+
+// --- FGGJHeatmap ---
+
+void FGGJHeatmap::Add(EGGJHeatmapLayer Layer, float X, float Y)
+{
+	const FIntPoint Cell(FMath::FloorToInt32(X / CellSize), FMath::FloorToInt32(Y / CellSize));
+	Layers[static_cast<int32>(Layer)].FindOrAdd(Cell)++;
+}
+
+bool FGGJHeatmap::Merge(const FGGJHeatmap& Other)
+{
+	if (!FMath::IsNearlyEqual(CellSize, Other.CellSize)) return false;
+
+	for (int32 i = 0; i < NumLayers; ++i)
+	{
+		for (const TPair<FIntPoint, uint32>& Cell : Other.Layers[i])
+		{
+			Layers[i].FindOrAdd(Cell.Key) += Cell.Value;
+		}
+	}
+	Matches += Other.Matches;
+	return true;
+}
+
+void FGGJHeatmap::Serialize(FArchive& Ar)
+{
+	using namespace GGJHeatmap;
+
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	Ar << Magic << Version;
+	if (Magic != FileMagic || Version != FileVersion)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << CellSize << Matches << MapName;
+
+	for (TMap<FIntPoint, uint32>& Layer : Layers)
+	{
+		int32 NumCells = Layer.Num();
+		Ar << NumCells;
+		if (NumCells < 0 || Ar.IsError())
+		{
+			Ar.SetError();
+			return;
+		}
+
+		if (Ar.IsSaving())
+		{
+			TArray<FIntPoint> Cells;
+			Layer.GenerateKeyArray(Cells);
+			Cells.Sort([](const FIntPoint& A, const FIntPoint& B) { return A.Y != B.Y ? A.Y < B.Y : A.X < B.X; });
+
+			FIntPoint Previous = FIntPoint::ZeroValue;
+			for (const FIntPoint& Cell : Cells)
+			{
+				uint32 DeltaY = ZigZag(Cell.Y - Previous.Y);
+				uint32 DeltaX = ZigZag(Cell.X - Previous.X);
+				uint32 Count = Layer[Cell];
+				Ar.SerializeIntPacked(DeltaY);
+				Ar.SerializeIntPacked(DeltaX);
+				Ar.SerializeIntPacked(Count);
+				Previous = Cell;
+			}
+		}
+		else
+		{
+			Layer.Reset();
+
+			FIntPoint Previous = FIntPoint::ZeroValue;
+			for (int32 i = 0; i < NumCells && !Ar.IsError(); ++i)
+			{
+				uint32 DeltaY = 0;
+				uint32 DeltaX = 0;
+				uint32 Count = 0;
+				Ar.SerializeIntPacked(DeltaY);
+				Ar.SerializeIntPacked(DeltaX);
+				Ar.SerializeIntPacked(Count);
+
+				Previous = FIntPoint(Previous.X + UnZigZag(DeltaX), Previous.Y + UnZigZag(DeltaY));
+				Layer.Add(Previous, Count);
+			}
+		}
+	}
+}
+
+bool FGGJHeatmap::Save(const FString& Path) const
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	const_cast<FGGJHeatmap*>(this)->Serialize(Writer);
+	return FFileHelper::SaveArrayToFile(Data, *Path);
+}
+
+bool FGGJHeatmap::Load(const FString& Path)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Path)) return false;
+
+	FMemoryReader Reader(Data);
+	Serialize(Reader);
+	return !Reader.IsError();
+}
+
+bool FGGJHeatmap::SavePng(EGGJHeatmapLayer Layer, const FString& Path) const
+{
+	using namespace GGJHeatmap;
+
+	const TMap<FIntPoint, uint32>& Cells = Layers[static_cast<int32>(Layer)];
+	if (Cells.Num() == 0) return false;
+
+	FIntPoint Min(MAX_int32, MAX_int32);
+	FIntPoint Max(MIN_int32, MIN_int32);
+	uint32 MaxCount = 0;
+	for (const TPair<FIntPoint, uint32>& Cell : Cells)
+	{
+		Min = Min.ComponentMin(Cell.Key);
+		Max = Max.ComponentMax(Cell.Key);
+		MaxCount = FMath::Max(MaxCount, Cell.Value);
+	}
+
+	const FIntPoint Size = Max - Min + FIntPoint(1, 1);
+	const FIntPoint Centre = (Min + Max) / 2;
+	const int32 Width = FMath::Min(Size.X, MaxImageSize);
+	const int32 Height = FMath::Min(Size.Y, MaxImageSize);
+	const FIntPoint Origin(Size.X > Width ? Centre.X - Width / 2 : Min.X, Size.Y > Height ? Centre.Y - Height / 2 : Min.Y);
+
+	TArray<FColor> Pixels;
+	Pixels.Init(FColor::Black, Width * Height);
+
+	const float Scale = 1.0f / FMath::Sqrt(static_cast<float>(MaxCount));
+	for (const TPair<FIntPoint, uint32>& Cell : Cells)
+	{
+		const int32 X = Cell.Key.X - Origin.X;
+		const int32 Y = Height - 1 - (Cell.Key.Y - Origin.Y);
+		if (X < 0 || X >= Width || Y < 0 || Y >= Height) continue;
+
+		Pixels[Y * Width + X] = GetHeatColor(FMath::Sqrt(static_cast<float>(Cell.Value)) * Scale);
+	}
+
+	return FImageUtils::SaveImageByExtension(*Path, FImageView(Pixels.GetData(), Width, Height));
+}
+
+const TCHAR* FGGJHeatmap::GetLayerName(EGGJHeatmapLayer Layer)
+{
+	switch (Layer)
+	{
+	case EGGJHeatmapLayer::PlayerPosition: return TEXT("PlayerPosition");
+	case EGGJHeatmapLayer::EnemyDeath: return TEXT("EnemyDeath");
+	case EGGJHeatmapLayer::PlayerHit: return TEXT("PlayerHit");
+	case EGGJHeatmapLayer::MaskThrow: return TEXT("MaskThrow");
+	default: return TEXT("Unknown");
+	}
+}
+
+FString FGGJHeatmap::GetHeatmapDir()
+{
+	return FPaths::ProfilingDir() / TEXT("GGJHeatmaps");
+}
+
+// --- UHeatmapSubsystem ---
+
+bool UHeatmapSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && (GGJHeatmap::Enable != 0 || FParse::Param(FCommandLine::Get(), TEXT("GGJHeatmap")));
+}
+
+bool UHeatmapSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHeatmapSubsystem::Deinitialize()
+{
+	if (bRecording) FinishMatch();
+
+	LastTask.Wait();
+
+	Super::Deinitialize();
+}
+
+TStatId UHeatmapSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHeatmapSubsystem, STATGROUP_Tickables);
+}
+
+void UHeatmapSubsystem::BeginMatch()
+{
+	if (bRecording) FinishMatch();
+
+	Ring = MakeShared<FRing>();
+
+	Heatmap = MakeShared<FGGJHeatmap>();
+	Heatmap->CellSize = FMath::Max(1.0f, GGJHeatmap::CellSize);
+	Heatmap->MapName = UWorld::RemovePIEPrefix(GetWorld()->GetMapName());
+
+	TimeUntilSample = 0.0f;
+	TimeUntilDrain = GGJHeatmap::DrainInterval;
+	NumSamples = 0;
+	NumDropped = 0;
+	bRecording = true;
+}
+
+void UHeatmapSubsystem::FinishMatch()
+{
+	if (!bRecording) return;
+
+	bRecording = false;
+
+	const FString Path = FGGJHeatmap::GetHeatmapDir() / FString::Printf(TEXT("%s-%s.ggjheat"), *Heatmap->MapName, *FDateTime::Now().ToString());
+	LaunchDrain(Path);
+	Ring.Reset();
+	Heatmap.Reset();
+
+	if (NumDropped > 0) UE_LOG(LogGGJHeatmap, Warning, TEXT("%d of %d heatmap samples dropped, the ring was full"), NumDropped, NumSamples + NumDropped);
+}
+
+void UHeatmapSubsystem::LaunchDrain(const FString& SavePath)
+{
+	LastTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Ring = Ring, Heatmap = Heatmap, SavePath]
+	{
+		LLM_SCOPE_BYTAG(GGJ);
+
+		FSample Sample;
+		while (Ring->Pop(Sample))
+		{
+			Heatmap->Add(Sample.Layer, Sample.X, Sample.Y);
+		}
+
+		if (SavePath.IsEmpty()) return;
+
+		if (Heatmap->Save(SavePath))
+		{
+			UE_LOG(LogGGJHeatmap, Log, TEXT("Wrote heatmap %s"), *SavePath);
+		}
+		else
+		{
+			UE_LOG(LogGGJHeatmap, Error, TEXT("Could not write heatmap %s"), *SavePath);
+		}
+	}, UE::Tasks::Prerequisites(LastTask));
+}
+
+void UHeatmapSubsystem::Tick(float DeltaTime)
+{
+	if (!bRecording) return;
+
+	TimeUntilSample -= DeltaTime;
+	if (TimeUntilSample <= 0.0f)
+	{
+		TimeUntilSample += FMath::Max(0.01f, GGJHeatmap::SampleInterval);
+		for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+		{
+			const APlayerController* PC = It->Get();
+			const APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+			if (Pawn) AddEvent(EGGJHeatmapLayer::PlayerPosition, Pawn->GetActorLocation());
+		}
+	}
+
+	// Never wait on the tasks here, a busy worker just means a bigger batch next time
+	TimeUntilDrain -= DeltaTime;
+	if (TimeUntilDrain <= 0.0f && LastTask.IsCompleted())
+	{
+		TimeUntilDrain = GGJHeatmap::DrainInterval;
+		LaunchDrain();
+	}
+}
+
+void UHeatmapSubsystem::AddEvent(EGGJHeatmapLayer Layer, const FVector& Location)
+{
+	if (!bRecording) return;
+
+	const FSample Sample = { static_cast<float>(Location.X), static_cast<float>(Location.Y), Layer };
+	if (Ring->Push(Sample))
+	{
+		++NumSamples;
+	}
+	else
+	{
+		++NumDropped;
+	}
+}
+
+void UHeatmapSubsystem::Record(const UObject* WorldContext, EGGJHeatmapLayer Layer, const FVector& Location)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	if (UHeatmapSubsystem* Heatmaps = World ? World->GetSubsystem<UHeatmapSubsystem>() : nullptr)
+	{
+		Heatmaps->AddEvent(Layer, Location);
+	}
+}
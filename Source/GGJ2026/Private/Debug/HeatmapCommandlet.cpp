@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/HeatmapCommandlet.h"
+
+#include "Debug/Heatmap.h"
+#include "Game/GGJStats.h"
+#include "HAL/FileManager.h"
+
+UHeatmapCommandlet::UHeatmapCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UHeatmapCommandlet::Main(const FString& Params)
+{
+	FString Dir = FGGJHeatmap::GetHeatmapDir();
+	FParse::Value(*Params, TEXT("Dir="), Dir);
+
+	FString OutDir = Dir / TEXT("Merged");
+	FParse::Value(*Params, TEXT("Out="), OutDir);
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *(Dir / TEXT("*.ggjheat")), true, false);
+	if (Files.Num() == 0)
+	{
+		UE_LOG(LogGGJHeatmap, Error, TEXT("No heatmap files in '%s'"), *Dir);
+		return 1;
+	}
+
+	// Arenas differ, so matches are only merged with matches on the same map
+	TMap<FString, FGGJHeatmap> Merged;
+	int32 Skipped = 0;
+	int32 Failed = 0;
+	for (const FString& File : Files)
+	{
+		FGGJHeatmap Heatmap;
+		if (!Heatmap.Load(Dir / File))
+		{
+			UE_LOG(LogGGJHeatmap, Warning, TEXT("Could not read heatmap '%s'"), *File);
+			++Skipped;
+			continue;
+		}
+
+		if (FGGJHeatmap* Existing = Merged.Find(Heatmap.MapName))
+		{
+			if (!Existing->Merge(Heatmap))
+			{
+				UE_LOG(LogGGJHeatmap, Warning, TEXT("Skipping '%s', cell size %.0f does not match %.0f"), *File, Heatmap.CellSize, Existing->CellSize);
+				++Skipped;
+			}
+		}
+		else
+		{
+			Merged.Add(Heatmap.MapName, MoveTemp(Heatmap));
+		}
+	}
+
+	for (const TPair<FString, FGGJHeatmap>& Pair : Merged)
+	{
+		const FGGJHeatmap& Heatmap = Pair.Value;
+		const FString MapName = Pair.Key.IsEmpty() ? TEXT("Unknown") : Pair.Key;
+
+		const FString MergedPath = OutDir / MapName + TEXT(".ggjheat");
+		if (!Heatmap.Save(MergedPath))
+		{
+			UE_LOG(LogGGJHeatmap, Error, TEXT("Could not write merged heatmap '%s'"), *MergedPath);
+			++Failed;
+			continue;
+		}
+
+		UE_LOG(LogGGJHeatmap, Display, TEXT("%s: %d matches, %.0f unit cells"), *MapName, Heatmap.Matches, Heatmap.CellSize);
+
+		for (int32 i = 0; i < FGGJHeatmap::NumLayers; ++i)
+		{
+			const EGGJHeatmapLayer Layer = static_cast<EGGJHeatmapLayer>(i);
+			const FString ImagePath = OutDir / FString::Printf(TEXT("%s-%s.png"), *MapName, FGGJHeatmap::GetLayerName(Layer));
+			if (Heatmap.SavePng(Layer, ImagePath))
+			{
+				UE_LOG(LogGGJHeatmap, Display, TEXT("  %-16s %6d cells -> %s"), FGGJHeatmap::GetLayerName(Layer), Heatmap.Layers[i].Num(), *ImagePath);
+			}
+		}
+	}
+
+	UE_LOG(LogGGJHeatmap, Display, TEXT("Merged %d heatmap files into %d maps, %d skipped, %d not written"), Files.Num() - Skipped, Merged.Num(), Skipped, Failed);
+	return Failed > 0 ? 1 : 0;
+}
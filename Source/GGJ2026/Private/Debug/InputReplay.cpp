@@ -0,0 +1,360 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/InputReplay.h"
+
+#include "EngineUtils.h"
+#include "EnhancedInputSubsystems.h"
+#include "EnhancedPlayerInput.h"
+#include "AI/EnemySpawnerManager.h"
+#include "Characters/GGJCharacter.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "Game/EnemySpawner.h"
+#include "Game/GGJGamemode.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGGJInputReplay, Log, All);
+
+namespace GGJInputReplay
+{
+	constexpr uint32 FileMagic = 0x494A4747; // "GGJI"
+	constexpr uint32 FileVersion = 1;
+
+	/** A replayed player further than this from the recorded location counts as drifted. */
+	constexpr float DriftTolerance = 10.0f;
+
+	float FixedFps = 30.0f;
+
+	UEnhancedInputLocalPlayerSubsystem* GetInputSubsystem(const AGGJCharacter* Character)
+	{
+		const APlayerController* PC = Cast<APlayerController>(Character->GetController());
+		return PC ? ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer()) : nullptr;
+	}
+}
+
+static FAutoConsoleVariableRef CVarInputReplayFixedFps(
+	TEXT("ggj.Input.FixedFps"),
+	GGJInputReplay::FixedFps,
+	TEXT("Fixed frame rate of input recordings, replays use the recorded one. 0 records with a variable time step, which does not replay reliably."));
+
+// --- FGGJInputRecording ---
+
+void FGGJInputRecording::Serialize(FArchive& Ar)
+{
+	using namespace GGJInputReplay;
+
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	Ar << Magic << Version;
+	if (Magic != FileMagic || Version != FileVersion)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << MapName << FixedDeltaTime << SpawnSeed << SpawnerSeeds << Frames << Checkpoints;
+}
+
+bool FGGJInputRecording::Save(const FString& Path) const
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	const_cast<FGGJInputRecording*>(this)->Serialize(Writer);
+	return FFileHelper::SaveArrayToFile(Data, *Path);
+}
+
+bool FGGJInputRecording::Load(const FString& Path)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Path)) return false;
+
+	FMemoryReader Reader(Data);
+	Serialize(Reader);
+	return !Reader.IsError() && Frames.Num() % MaxPlayers == 0;
+}
+
+FString FGGJInputRecording::GetRecordingDir()
+{
+	return FPaths::ProfilingDir() / TEXT("GGJInput");
+}
+
+// --- UInputReplaySubsystem ---
+
+bool UInputReplaySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UInputReplaySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// The spawn seed has to be in place before anything spawns
+	UEnemySpawnerManager* SpawnerManager = Collection.InitializeDependency<UEnemySpawnerManager>();
+
+	// Only the first world of the process, the recording covers one match
+	static bool bUsedCommandLine = false;
+	if (bUsedCommandLine) return;
+
+	const FString MapName = UWorld::RemovePIEPrefix(GetWorld()->GetMapName());
+
+	FString Path;
+	if (FParse::Value(FCommandLine::Get(), TEXT("GGJReplay="), Path))
+	{
+		bUsedCommandLine = true;
+		if (!Recording.Load(Path))
+		{
+			UE_LOG(LogGGJInputReplay, Error, TEXT("Could not read input recording '%s'"), *Path);
+			return;
+		}
+
+		if (Recording.MapName != MapName)
+		{
+			UE_LOG(LogGGJInputReplay, Warning, TEXT("'%s' was recorded on %s, replaying on %s"), *Path, *Recording.MapName, *MapName);
+		}
+
+		if (SpawnerManager) SpawnerManager->SetRandomSeed(Recording.SpawnSeed);
+		RecordingPath = Path;
+		bReplaying = true;
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("GGJRecordInput="), Path) || FParse::Param(FCommandLine::Get(), TEXT("GGJRecordInput")))
+	{
+		bUsedCommandLine = true;
+		Recording.MapName = MapName;
+		Recording.FixedDeltaTime = GGJInputReplay::FixedFps > 0.0f ? 1.0f / GGJInputReplay::FixedFps : 0.0f;
+		Recording.SpawnSeed = SpawnerManager ? SpawnerManager->GetRandomSeed() : 0;
+		RecordingPath = !Path.IsEmpty() ? Path : FGGJInputRecording::GetRecordingDir() / FString::Printf(TEXT("%s-%s.ggjinput"), *MapName, *FDateTime::Now().ToString());
+		bRecording = true;
+	}
+
+	// Both runs step the simulation by the same amount every frame, however long the frame took
+	if ((bRecording || bReplaying) && Recording.FixedDeltaTime > 0.0f)
+	{
+		bOverrodeTimeStep = true;
+		bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+		PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+
+		FApp::SetUseFixedTimeStep(true);
+		FApp::SetFixedDeltaTime(Recording.FixedDeltaTime);
+
+		// A fixed time step never waits. Someone playing has to get the recorded rate in real time too,
+		// only a headless replay may run as fast as the machine allows
+		bThrottleToFixedRate = bRecording || FApp::CanEverRender();
+		NextFrameRealTime = FPlatformTime::Seconds();
+	}
+}
+
+void UInputReplaySubsystem::Deinitialize()
+{
+	if (bRecording)
+	{
+		bRecording = false;
+		if (Recording.Save(RecordingPath))
+		{
+			UE_LOG(LogGGJInputReplay, Log, TEXT("Wrote %d frames of input with spawn seed %d to %s"), Recording.GetNumFrames(), Recording.SpawnSeed, *RecordingPath);
+		}
+		else
+		{
+			UE_LOG(LogGGJInputReplay, Error, TEXT("Could not write input recording %s"), *RecordingPath);
+		}
+	}
+
+	if (bOverrodeTimeStep)
+	{
+		bOverrodeTimeStep = false;
+		FApp::SetUseFixedTimeStep(bPreviousUseFixedTimeStep);
+		FApp::SetFixedDeltaTime(PreviousFixedDeltaTime);
+	}
+
+	Super::Deinitialize();
+}
+
+void UInputReplaySubsystem::ThrottleToFixedRate()
+{
+	// Falling behind is not made up for, the next frame is timed from now
+	const double Now = FPlatformTime::Seconds();
+	NextFrameRealTime = FMath::Max(NextFrameRealTime + Recording.FixedDeltaTime, Now);
+	if (NextFrameRealTime > Now)
+	{
+		FPlatformProcess::SleepNoStats(static_cast<float>(NextFrameRealTime - Now));
+	}
+}
+
+void UInputReplaySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (!bRecording && !bReplaying) return;
+
+	// Spawners take their seeds in BeginPlay, which comes after this
+	const UEnemySpawnerManager* SpawnerManager = InWorld.GetSubsystem<UEnemySpawnerManager>();
+	for (TActorIterator<AEnemySpawner> It(&InWorld); It && SpawnerManager; ++It)
+	{
+		const int32 Seed = SpawnerManager->GetSpawnerSeed(*It);
+		if (bRecording)
+		{
+			Recording.SpawnerSeeds.Add(It->GetName(), Seed);
+		}
+		else if (const int32* RecordedSeed = Recording.SpawnerSeeds.Find(It->GetName()); !RecordedSeed || *RecordedSeed != Seed)
+		{
+			UE_LOG(LogGGJInputReplay, Warning, TEXT("Spawner %s was not in the recording or has another seed, the level changed"), *It->GetName());
+		}
+	}
+
+	Frame = 0;
+	if (bReplaying)
+	{
+		UE_LOG(LogGGJInputReplay, Log, TEXT("Replaying %d frames from %s"), Recording.GetNumFrames(), *RecordingPath);
+		if (Recording.GetNumFrames() > 0) InjectFrame(0);
+	}
+}
+
+TStatId UInputReplaySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInputReplaySubsystem, STATGROUP_Tickables);
+}
+
+void UInputReplaySubsystem::Tick(float DeltaTime)
+{
+	if (bThrottleToFixedRate) ThrottleToFixedRate();
+
+	if (bRecording)
+	{
+		CaptureFrame();
+		return;
+	}
+
+	if (!bReplaying) return;
+
+	// Input injected now is read when the players tick next frame
+	CheckDrift();
+	if (++Frame >= Recording.GetNumFrames())
+	{
+		FinishReplay();
+		return;
+	}
+	InjectFrame(Frame);
+}
+
+void UInputReplaySubsystem::GetLocalCharacters(TArray<AGGJCharacter*, TInlineAllocator<FGGJInputRecording::MaxPlayers>>& OutCharacters) const
+{
+	OutCharacters.Init(nullptr, FGGJInputRecording::MaxPlayers);
+
+	const UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	if (!GameInstance) return;
+
+	const TArray<ULocalPlayer*>& LocalPlayers = GameInstance->GetLocalPlayers();
+	for (int32 i = 0; i < FMath::Min(LocalPlayers.Num(), FGGJInputRecording::MaxPlayers); ++i)
+	{
+		const APlayerController* PC = LocalPlayers[i]->GetPlayerController(GetWorld());
+		OutCharacters[i] = PC ? Cast<AGGJCharacter>(PC->GetPawn()) : nullptr;
+	}
+}
+
+void UInputReplaySubsystem::CaptureFrame()
+{
+	TArray<AGGJCharacter*, TInlineAllocator<FGGJInputRecording::MaxPlayers>> Characters;
+	GetLocalCharacters(Characters);
+
+	const bool bCheckpoint = Frame % FGGJInputRecording::CheckpointInterval == 0;
+	for (const AGGJCharacter* Character : Characters)
+	{
+		FGGJInputFrame& Input = Recording.Frames.AddDefaulted_GetRef();
+		if (bCheckpoint) Recording.Checkpoints.Add(Character ? FVector3f(Character->GetActorLocation()) : FVector3f::ZeroVector);
+
+		const UEnhancedInputLocalPlayerSubsystem* InputSubsystem = Character ? GGJInputReplay::GetInputSubsystem(Character) : nullptr;
+		const UEnhancedPlayerInput* PlayerInput = InputSubsystem ? InputSubsystem->GetPlayerInput() : nullptr;
+		if (!PlayerInput) continue;
+
+		auto IsPressed = [PlayerInput](const UInputAction* Action) { return Action && PlayerInput->GetActionValue(Action).Get<bool>(); };
+
+		Input.Buttons = FGGJInputFrame::Present;
+		if (Character->MoveAction) Input.Move = FVector2f(PlayerInput->GetActionValue(Character->MoveAction).Get<FVector2D>());
+		if (IsPressed(Character->AttackAction)) Input.Buttons |= FGGJInputFrame::Attack;
+		if (IsPressed(Character->RollAction)) Input.Buttons |= FGGJInputFrame::Roll;
+		if (IsPressed(Character->JumpAction)) Input.Buttons |= FGGJInputFrame::Jump;
+		if (IsPressed(Character->InteractAction)) Input.Buttons |= FGGJInputFrame::Interact;
+	}
+
+	++Frame;
+}
+
+void UInputReplaySubsystem::InjectFrame(int32 FrameIndex)
+{
+	TArray<AGGJCharacter*, TInlineAllocator<FGGJInputRecording::MaxPlayers>> Characters;
+	GetLocalCharacters(Characters);
+
+	for (int32 Slot = 0; Slot < FGGJInputRecording::MaxPlayers; ++Slot)
+	{
+		const FGGJInputFrame& Input = Recording.Frames[FrameIndex * FGGJInputRecording::MaxPlayers + Slot];
+		if (!(Input.Buttons & FGGJInputFrame::Present)) continue;
+
+		AGGJCharacter* Character = Characters[Slot];
+		if (!Character)
+		{
+			// The second player joined at this point of the recording
+			const UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+			AGGJGamemode* GameMode = GetWorld()->GetAuthGameMode<AGGJGamemode>();
+			if (Slot == 1 && GameMode && GameInstance && GameInstance->GetNumLocalPlayers() < 2) GameMode->InitializeSecondPlayer();
+			continue;
+		}
+
+		UEnhancedInputLocalPlayerSubsystem* InputSubsystem = GGJInputReplay::GetInputSubsystem(Character);
+		if (!InputSubsystem) continue;
+
+		auto Inject = [InputSubsystem](const UInputAction* Action, const FInputActionValue& Value)
+		{
+			if (Action) InputSubsystem->InjectInputForAction(Action, Value);
+		};
+
+		// Released actions are simply not injected, which completes them
+		if (!Input.Move.IsZero()) Inject(Character->MoveAction, FInputActionValue(FVector2D(Input.Move)));
+		if (Input.Buttons & FGGJInputFrame::Attack) Inject(Character->AttackAction, FInputActionValue(true));
+		if (Input.Buttons & FGGJInputFrame::Roll) Inject(Character->RollAction, FInputActionValue(true));
+		if (Input.Buttons & FGGJInputFrame::Jump) Inject(Character->JumpAction, FInputActionValue(true));
+		if (Input.Buttons & FGGJInputFrame::Interact) Inject(Character->InteractAction, FInputActionValue(true));
+	}
+}
+
+void UInputReplaySubsystem::CheckDrift()
+{
+	if (Frame % FGGJInputRecording::CheckpointInterval != 0) return;
+
+	const int32 First = Frame / FGGJInputRecording::CheckpointInterval * FGGJInputRecording::MaxPlayers;
+	if (!Recording.Checkpoints.IsValidIndex(First + FGGJInputRecording::MaxPlayers - 1)) return;
+
+	TArray<AGGJCharacter*, TInlineAllocator<FGGJInputRecording::MaxPlayers>> Characters;
+	GetLocalCharacters(Characters);
+
+	for (int32 Slot = 0; Slot < FGGJInputRecording::MaxPlayers; ++Slot)
+	{
+		if (!Characters[Slot]) continue;
+
+		const float Drift = FVector3f::Dist(FVector3f(Characters[Slot]->GetActorLocation()), Recording.Checkpoints[First + Slot]);
+		MaxDrift = FMath::Max(MaxDrift, Drift);
+		if (Drift > GGJInputReplay::DriftTolerance && FirstDriftFrame == INDEX_NONE)
+		{
+			FirstDriftFrame = Frame;
+			UE_LOG(LogGGJInputReplay, Warning, TEXT("Player %d is %.1f units off the recording at frame %d, the rest of the replay is a different match"), Slot, Drift, Frame);
+		}
+	}
+}
+
+void UInputReplaySubsystem::FinishReplay()
+{
+	bReplaying = false;
+
+	UE_LOG(LogGGJInputReplay, Log, TEXT("Replayed %d frames from %s, max drift %.1f units%s"), Recording.GetNumFrames(), *RecordingPath, MaxDrift,
+		FirstDriftFrame == INDEX_NONE ? TEXT("") : *FString::Printf(TEXT(", drifted from frame %d"), FirstDriftFrame));
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("GGJReplayExit")))
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
@@ -0,0 +1,163 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/ObjectAccounting.h"
+
+#include "UObject/Package.h"
+#include "UObject/UObjectIterator.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGGJObjects, Log, All);
+
+namespace GGJObjectAccounting
+{
+	const FName ModulePackage(TEXT("/Script/GGJ2026"));
+}
+
+FGGJObjectAccounting& FGGJObjectAccounting::Get()
+{
+	static FGGJObjectAccounting Instance;
+	return Instance;
+}
+
+void FGGJObjectAccounting::Start()
+{
+	check(IsInGameThread());
+	if (bRunning) return;
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		Counts.Reset();
+		TrackedObjects.Reset();
+	}
+
+	GUObjectArray.AddUObjectCreateListener(this);
+	GUObjectArray.AddUObjectDeleteListener(this);
+	bRunning = true;
+
+	// Objects alive before tracking started count as live but not as created
+	for (FThreadSafeObjectIterator It; It; ++It)
+	{
+		Add(*It, GUObjectArray.ObjectToIndex(*It), false);
+	}
+}
+
+void FGGJObjectAccounting::Stop()
+{
+	check(IsInGameThread());
+	if (!bRunning) return;
+
+	GUObjectArray.RemoveUObjectCreateListener(this);
+	GUObjectArray.RemoveUObjectDeleteListener(this);
+	bRunning = false;
+}
+
+void FGGJObjectAccounting::ResetHighWater()
+{
+	FScopeLock ScopeLock(&Lock);
+	for (TPair<FName, FClassCount>& Pair : Counts)
+	{
+		Pair.Value.HighWater = Pair.Value.Live;
+	}
+}
+
+TMap<FName, FGGJObjectAccounting::FClassCount> FGGJObjectAccounting::GetCounts() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Counts;
+}
+
+int32 FGGJObjectAccounting::GetLiveCount(FName ClassName) const
+{
+	FScopeLock ScopeLock(&Lock);
+	const FClassCount* Count = Counts.Find(ClassName);
+	return Count ? Count->Live : 0;
+}
+
+void FGGJObjectAccounting::LogReport() const
+{
+	if (!bRunning)
+	{
+		UE_LOG(LogGGJObjects, Display, TEXT("Object accounting is not running, start it with ggj.Objects.Start"));
+		return;
+	}
+
+	TMap<FName, FClassCount> Snapshot = GetCounts();
+	Snapshot.ValueSort([](const FClassCount& A, const FClassCount& B) { return A.Live != B.Live ? A.Live > B.Live : A.HighWater > B.HighWater; });
+
+	UE_LOG(LogGGJObjects, Display, TEXT("%-48s %8s %10s %8s"), TEXT("Class"), TEXT("Live"), TEXT("HighWater"), TEXT("Created"));
+	for (const TPair<FName, FClassCount>& Pair : Snapshot)
+	{
+		UE_LOG(LogGGJObjects, Display, TEXT("%-48s %8d %10d %8d"), *Pair.Key.ToString(), Pair.Value.Live, Pair.Value.HighWater, Pair.Value.Created);
+	}
+}
+
+bool FGGJObjectAccounting::IsGameClass(const UClass* Class)
+{
+	while (Class && !Class->HasAnyClassFlags(CLASS_Native))
+	{
+		Class = Class->GetSuperClass();
+	}
+
+	return Class && Class->GetOutermost()->GetFName() == GGJObjectAccounting::ModulePackage;
+}
+
+void FGGJObjectAccounting::Add(const UObjectBase* Object, int32 Index, bool bCreated)
+{
+	const UClass* Class = Object->GetClass();
+
+	// Class default objects and archetypes are part of the class, not of the match
+	if (!IsGameClass(Class) || EnumHasAnyFlags(Object->GetFlags(), RF_ClassDefaultObject | RF_ArchetypeObject)) return;
+
+	const FName ClassName = Class->GetFName();
+
+	FScopeLock ScopeLock(&Lock);
+
+	// Created while Start was still iterating
+	if (TrackedObjects.Contains(Index)) return;
+	TrackedObjects.Add(Index, ClassName);
+
+	FClassCount& Count = Counts.FindOrAdd(ClassName);
+	Count.Live++;
+	Count.Created += bCreated ? 1 : 0;
+	Count.HighWater = FMath::Max(Count.HighWater, Count.Live);
+}
+
+void FGGJObjectAccounting::NotifyUObjectCreated(const UObjectBase* Object, int32 Index)
+{
+	Add(Object, Index, true);
+}
+
+void FGGJObjectAccounting::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	FName ClassName;
+	if (!TrackedObjects.RemoveAndCopyValue(Index, ClassName)) return;
+
+	if (FClassCount* Count = Counts.Find(ClassName))
+	{
+		Count->Live--;
+	}
+}
+
+void FGGJObjectAccounting::OnUObjectArrayShutdown()
+{
+	GUObjectArray.RemoveUObjectCreateListener(this);
+	GUObjectArray.RemoveUObjectDeleteListener(this);
+	bRunning = false;
+}
+
+static FAutoConsoleCommand GObjectAccountingStartCommand(
+	TEXT("ggj.Objects.Start"),
+	TEXT("Start counting live GGJ objects per class."),
+	FConsoleCommandDelegate::CreateLambda([]() { FGGJObjectAccounting::Get().Start(); }));
+
+static FAutoConsoleCommand GObjectAccountingStopCommand(
+	TEXT("ggj.Objects.Stop"),
+	TEXT("Stop counting live GGJ objects."),
+	FConsoleCommandDelegate::CreateLambda([]() { FGGJObjectAccounting::Get().Stop(); }));
+
+static FAutoConsoleCommand GObjectAccountingReportCommand(
+	TEXT("ggj.Objects.Report"),
+	TEXT("Log live, high-water and created counts of GGJ objects per class."),
+	FConsoleCommandDelegate::CreateLambda([]() { FGGJObjectAccounting::Get().LogReport(); }));
@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/PerfCaptureSettings.h"
+
+void UPerfCaptureSettings::ApplyCommandLine(const TCHAR* CommandLine)
+{
+	FParse::Value(CommandLine, TEXT("PerfDuration="), Duration);
+	FParse::Value(CommandLine, TEXT("PerfWarmupSeconds="), WarmupSeconds);
+	FParse::Value(CommandLine, TEXT("PerfMaxEnemies="), MaxEnemies);
+	FParse::Value(CommandLine, TEXT("PerfMaxActiveEnemies="), MaxActiveEnemies);
+	FParse::Value(CommandLine, TEXT("PerfSpawnRate="), SpawnRate);
+	FParse::Value(CommandLine, TEXT("PerfBotPlayers="), BotPlayers);
+	FParse::Value(CommandLine, TEXT("PerfBotDecisionInterval="), BotDecisionInterval);
+	FParse::Value(CommandLine, TEXT("PerfSeed="), Seed);
+	FParse::Value(CommandLine, TEXT("PerfSpawnHitchMs="), SpawnHitchMs);
+	FParse::Value(CommandLine, TEXT("PerfBudgetP50Ms="), BudgetP50Ms);
+	FParse::Value(CommandLine, TEXT("PerfBudgetP95Ms="), BudgetP95Ms);
+	FParse::Value(CommandLine, TEXT("PerfBudgetP99Ms="), BudgetP99Ms);
+	FParse::Value(CommandLine, TEXT("PerfBudgetSpawnHitches="), BudgetSpawnHitches);
+	FParse::Value(CommandLine, TEXT("PerfBudgetMemoryGrowthKBPerFrame="), BudgetMemoryGrowthKBPerFrame);
+
+	FString EnemyClassPath;
+	if (FParse::Value(CommandLine, TEXT("PerfEnemyClass="), EnemyClassPath))
+	{
+		EnemyClass = FSoftClassPath(EnemyClassPath);
+	}
+
+	BotPlayers = FMath::Clamp(BotPlayers, 1, 2);
+}
@@ -0,0 +1,304 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/PerfCaptureSubsystem.h"
+
+#include "CoreGlobals.h"
+#include "EngineUtils.h"
+#include "AI/EnemySpawnerManager.h"
+#include "Characters/EnemyCharacter.h"
+#include "Characters/GGJCharacter.h"
+#include "Debug/InputReplay.h"
+#include "Debug/PerfCaptureSettings.h"
+#include "Game/GGJGamemode.h"
+#include "Game/GGJStats.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGGJPerf, Log, All);
+
+FString FPerfCaptureSummary::ToString() const
+{
+	FString Result = FString::Printf(
+		TEXT("Frames: %d\nGame thread ms: p50 %.2f | p95 %.2f | p99 %.2f | max %.2f\nSpawns: %d | spawn hitches: %d\nMemory growth per frame: %.2f KB\n"),
+		Frames, GameThreadP50Ms, GameThreadP95Ms, GameThreadP99Ms, GameThreadMaxMs, Spawns, SpawnHitches, MemoryGrowthKBPerFrame);
+
+	if (IsWithinBudget())
+	{
+		Result += TEXT("Within budget\n");
+	}
+
+	for (const FString& Failure : BudgetFailures)
+	{
+		Result += FString::Printf(TEXT("OVER BUDGET: %s\n"), *Failure);
+	}
+
+	return Result;
+}
+
+bool UPerfCaptureSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPerfCaptureSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Only the first world of the process, a capture that travels would measure the load
+	static bool bStartedFromCommandLine = false;
+	if (!bStartedFromCommandLine && FParse::Param(FCommandLine::Get(), TEXT("GGJPerfCapture")))
+	{
+		bStartedFromCommandLine = true;
+		StartCapture(true);
+	}
+}
+
+TStatId UPerfCaptureSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPerfCaptureSubsystem, STATGROUP_Tickables);
+}
+
+void UPerfCaptureSubsystem::StartCapture(bool bInExitWhenDone)
+{
+	if (bCapturing) return;
+
+	Settings = NewObject<UPerfCaptureSettings>(this);
+	Settings->ApplyCommandLine(FCommandLine::Get());
+
+	Random.Initialize(Settings->Seed);
+	Samples.Reset();
+	Bots.Reset();
+	ElapsedTime = 0.0f;
+	bCapturing = true;
+	bRecording = false;
+	bExitWhenDone = bInExitWhenDone;
+
+	UE_LOG(LogGGJPerf, Display, TEXT("Perf capture: %.0fs warm-up, %.0fs recorded, %d enemies (%d active), spawn every %.2fs, %d bot(s)"),
+		Settings->WarmupSeconds, Settings->Duration, Settings->MaxEnemies, Settings->MaxActiveEnemies, Settings->SpawnRate, Settings->BotPlayers);
+
+	ApplyScenario();
+}
+
+void UPerfCaptureSubsystem::ApplyScenario()
+{
+	UWorld* World = GetWorld();
+
+	if (Settings->BotPlayers > 1)
+	{
+		if (AGGJGamemode* GameMode = World->GetAuthGameMode<AGGJGamemode>())
+		{
+			GameMode->InitializeSecondPlayer();
+		}
+	}
+
+	UEnemySpawnerManager* Spawner = World->GetSubsystem<UEnemySpawnerManager>();
+	if (!Spawner) return;
+
+	Spawner->SetMaxEnemies(Settings->MaxEnemies);
+	Spawner->SetMaxActiveEnemies(Settings->MaxActiveEnemies);
+	Spawner->SetSpawnRate(Settings->SpawnRate);
+
+	if (!Spawner->HasEnemyClass() && Settings->EnemyClass.IsValid())
+	{
+		Spawner->SetEnemyClass(Settings->EnemyClass.TryLoadClass<AEnemyCharacter>());
+	}
+
+	// Restart with the forced settings, whether or not the level already started spawning
+	Spawner->ClearSpawnTimer();
+	Spawner->SetSpawnTimer();
+	LastNumSpawned = Spawner->GetNumSpawned();
+}
+
+void UPerfCaptureSubsystem::Tick(float DeltaTime)
+{
+	if (!bCapturing) return;
+
+	ElapsedTime += DeltaTime;
+	DriveBots();
+
+	if (!bRecording)
+	{
+		if (ElapsedTime >= Settings->WarmupSeconds) BeginRecording();
+		return;
+	}
+
+	const UEnemySpawnerManager* Spawner = GetWorld()->GetSubsystem<UEnemySpawnerManager>();
+	const int32 NumSpawned = Spawner ? Spawner->GetNumSpawned() : 0;
+
+	// Game thread time of the previous frame, the current one is still running
+	FFrameSample& Sample = Samples.AddDefaulted_GetRef();
+	Sample.GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	Sample.bSpawned = NumSpawned != LastNumSpawned;
+	LastNumSpawned = NumSpawned;
+
+	CSV_CUSTOM_STAT(GGJ, ActiveEnemies, Spawner ? Spawner->GetNumActiveEnemies() : 0, ECsvCustomStatOp::Set);
+
+	if (ElapsedTime >= Settings->WarmupSeconds + Settings->Duration)
+	{
+		FinishCapture();
+	}
+}
+
+void UPerfCaptureSubsystem::DriveBots()
+{
+	// A replay already drives the players with recorded input
+	const UInputReplaySubsystem* Replay = GetWorld()->GetSubsystem<UInputReplaySubsystem>();
+	if (Replay && Replay->IsReplaying()) return;
+
+	// Players can join late (second local player) or respawn, pick them up as they appear
+	int32 BotIndex = 0;
+	for (TActorIterator<AGGJCharacter> It(GetWorld()); It && BotIndex < Settings->BotPlayers; ++It, ++BotIndex)
+	{
+		if (!Bots.IsValidIndex(BotIndex)) Bots.AddDefaulted();
+
+		FBotState& Bot = Bots[BotIndex];
+		if (Bot.Player != *It)
+		{
+			Bot = FBotState();
+			Bot.Player = *It;
+		}
+
+		if (ElapsedTime >= Bot.NextDecisionTime)
+		{
+			const float Angle = Random.FRandRange(0.0f, 2.0f * PI);
+			Bot.Direction = Random.FRand() < 0.2f ? FVector2D::ZeroVector : FVector2D(FMath::Cos(Angle), FMath::Sin(Angle));
+			Bot.NextDecisionTime = ElapsedTime + Settings->BotDecisionInterval;
+		}
+
+		if (!Bot.Direction.IsZero())
+		{
+			It->ApplyMovementInput(Bot.Direction, false);
+		}
+
+		if (ElapsedTime >= Bot.NextAttackTime)
+		{
+			It->PerformAttack();
+			Bot.NextAttackTime = ElapsedTime + Settings->BotDecisionInterval * 0.5f;
+		}
+	}
+}
+
+void UPerfCaptureSubsystem::BeginRecording()
+{
+	bRecording = true;
+	RecordingStartMemory = FPlatformMemory::GetStats().UsedPhysical;
+
+	if (const UEnemySpawnerManager* Spawner = GetWorld()->GetSubsystem<UEnemySpawnerManager>())
+	{
+		LastNumSpawned = Spawner->GetNumSpawned();
+	}
+
+#if CSV_PROFILER
+	if (FCsvProfiler* Csv = FCsvProfiler::Get())
+	{
+		Csv->SetMetadata(TEXT("GGJMaxEnemies"), *LexToString(Settings->MaxEnemies));
+		Csv->SetMetadata(TEXT("GGJMaxActiveEnemies"), *LexToString(Settings->MaxActiveEnemies));
+		Csv->SetMetadata(TEXT("GGJSpawnRate"), *LexToString(Settings->SpawnRate));
+		Csv->SetMetadata(TEXT("GGJBotPlayers"), *LexToString(Settings->BotPlayers));
+		Csv->BeginCapture(-1, FPaths::ProfilingDir() / TEXT("GGJPerf"), FString());
+	}
+#endif
+}
+
+FPerfCaptureSummary UPerfCaptureSubsystem::Summarize() const
+{
+	FPerfCaptureSummary Summary;
+	Summary.Frames = Samples.Num();
+	if (Summary.Frames == 0) return Summary;
+
+	TArray<float> Times;
+	Times.Reserve(Samples.Num());
+	for (const FFrameSample& Sample : Samples)
+	{
+		Times.Add(Sample.GameThreadMs);
+
+		if (Sample.bSpawned)
+		{
+			Summary.Spawns++;
+			if (Sample.GameThreadMs > Settings->SpawnHitchMs) Summary.SpawnHitches++;
+		}
+	}
+	Times.Sort();
+
+	Summary.GameThreadP50Ms = GetPercentile(Times, 50.0f);
+	Summary.GameThreadP95Ms = GetPercentile(Times, 95.0f);
+	Summary.GameThreadP99Ms = GetPercentile(Times, 99.0f);
+	Summary.GameThreadMaxMs = Times.Last();
+
+	const int64 MemoryGrowth = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(RecordingStartMemory);
+	Summary.MemoryGrowthKBPerFrame = MemoryGrowth / 1024.0f / Summary.Frames;
+
+	auto CheckBudget = [&Summary](const TCHAR* Name, float Value, float Budget)
+	{
+		if (Budget > 0.0f && Value > Budget)
+		{
+			Summary.BudgetFailures.Add(FString::Printf(TEXT("%s %.2f > %.2f"), Name, Value, Budget));
+		}
+	};
+
+	CheckBudget(TEXT("Game thread p50 ms"), Summary.GameThreadP50Ms, Settings->BudgetP50Ms);
+	CheckBudget(TEXT("Game thread p95 ms"), Summary.GameThreadP95Ms, Settings->BudgetP95Ms);
+	CheckBudget(TEXT("Game thread p99 ms"), Summary.GameThreadP99Ms, Settings->BudgetP99Ms);
+	CheckBudget(TEXT("Memory growth KB per frame"), Summary.MemoryGrowthKBPerFrame, Settings->BudgetMemoryGrowthKBPerFrame);
+
+	// 0 hitches is a valid budget, unlike the others
+	if (Settings->BudgetSpawnHitches >= 0 && Summary.SpawnHitches > Settings->BudgetSpawnHitches)
+	{
+		Summary.BudgetFailures.Add(FString::Printf(TEXT("Spawn hitches %d > %d"), Summary.SpawnHitches, Settings->BudgetSpawnHitches));
+	}
+
+	return Summary;
+}
+
+void UPerfCaptureSubsystem::FinishCapture()
+{
+	bCapturing = false;
+	bRecording = false;
+
+#if CSV_PROFILER
+	if (FCsvProfiler* Csv = FCsvProfiler::Get())
+	{
+		Csv->EndCapture();
+	}
+#endif
+
+	const FPerfCaptureSummary Summary = Summarize();
+	const FString Report = Summary.ToString();
+
+	TArray<FString> Lines;
+	Report.ParseIntoArrayLines(Lines);
+	for (const FString& Line : Lines)
+	{
+		UE_LOG(LogGGJPerf, Display, TEXT("%s"), *Line);
+	}
+
+	const FString SummaryPath = FPaths::ProfilingDir() / TEXT("GGJPerf") / FString::Printf(TEXT("Summary-%s.txt"), *FDateTime::Now().ToString());
+	FFileHelper::SaveStringToFile(Report, *SummaryPath);
+	UE_LOG(LogGGJPerf, Display, TEXT("Summary written to %s"), *SummaryPath);
+
+	if (bExitWhenDone)
+	{
+		FPlatformMisc::RequestExitWithStatus(false, Summary.IsWithinBudget() ? 0 : 1);
+	}
+}
+
+float UPerfCaptureSubsystem::GetPercentile(TConstArrayView<float> SortedValues, float Percentile)
+{
+	if (SortedValues.Num() == 0) return 0.0f;
+
+	const int32 Rank = FMath::CeilToInt(Percentile / 100.0f * SortedValues.Num());
+	return SortedValues[FMath::Clamp(Rank - 1, 0, SortedValues.Num() - 1)];
+}
+
+static FAutoConsoleCommandWithWorld GPerfCaptureCommand(
+	TEXT("ggj.Perf.Capture"),
+	TEXT("Run the perf capture scenario in the current world and log the summary. Settings come from UPerfCaptureSettings and -Perf<Name>= overrides."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UPerfCaptureSubsystem* Capture = World ? World->GetSubsystem<UPerfCaptureSubsystem>() : nullptr)
+		{
+			Capture->StartCapture(false);
+		}
+	}));
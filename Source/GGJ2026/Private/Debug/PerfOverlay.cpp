@@ -0,0 +1,177 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Debug/PerfOverlay.h"
+
+#if !UE_BUILD_SHIPPING
+#include "CoreGlobals.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/Font.h"
+#include "GameFramework/PlayerController.h"
+#include "AI/EnemyManager.h"
+#include "AI/EnemyPathBroker.h"
+#include "AI/EnemySpawnerManager.h"
+#include "AI/EnemySteeringSubsystem.h"
+#include "Animation/EnemyAnimBudgetSubsystem.h"
+#include "Game/GGJStats.h"
+#include "Items/MaskPickup.h"
+
+namespace GGJPerfOverlay
+{
+	/** Weight of the newest frame in the averaged times. */
+	constexpr float Smoothing = 0.1f;
+
+	struct FSystemTiming
+	{
+		FGGJStatTimings::FEntry LastTotal;
+		float AverageMs = 0.0f;
+		float AverageCalls = 0.0f;
+	};
+
+	FDelegateHandle DrawHandle;
+	bool bStartedTimings = false;
+	uint64 LastSampleFrame = 0;
+	float AverageGameThreadMs = 0.0f;
+	TMap<FName, FSystemTiming> Systems;
+}
+
+void FGGJPerfOverlay::SetVisible(bool bVisible)
+{
+	using namespace GGJPerfOverlay;
+
+	if (bVisible == IsVisible()) return;
+
+	if (bVisible)
+	{
+		// A running benchmark owns the timings, the overlay only reads them
+		if (!FGGJStatTimings::IsRecording())
+		{
+			FGGJStatTimings::Start();
+			bStartedTimings = true;
+		}
+		Systems.Reset();
+		LastSampleFrame = GFrameCounter;
+		DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateStatic(&FGGJPerfOverlay::Draw));
+	}
+	else
+	{
+		UDebugDrawService::Unregister(DrawHandle);
+		DrawHandle.Reset();
+		if (bStartedTimings) FGGJStatTimings::Stop();
+		bStartedTimings = false;
+	}
+}
+
+bool FGGJPerfOverlay::IsVisible()
+{
+	return GGJPerfOverlay::DrawHandle.IsValid();
+}
+
+void FGGJPerfOverlay::SampleTimings()
+{
+	using namespace GGJPerfOverlay;
+
+	if (GFrameCounter == LastSampleFrame) return;
+
+	const float Frames = static_cast<float>(GFrameCounter - LastSampleFrame);
+	LastSampleFrame = GFrameCounter;
+
+	AverageGameThreadMs = FMath::Lerp(AverageGameThreadMs, FPlatformTime::ToMilliseconds(GGameThreadTime), Smoothing);
+
+	for (const TPair<FName, FGGJStatTimings::FEntry>& Pair : FGGJStatTimings::GetTotals())
+	{
+		FSystemTiming& System = Systems.FindOrAdd(Pair.Key);
+
+		// Totals restart when a benchmark calls Start
+		if (Pair.Value.Calls < System.LastTotal.Calls) System.LastTotal = FGGJStatTimings::FEntry();
+
+		const float FrameMs = static_cast<float>((Pair.Value.Seconds - System.LastTotal.Seconds) * 1000.0) / Frames;
+		const float FrameCalls = (Pair.Value.Calls - System.LastTotal.Calls) / Frames;
+		System.AverageMs = FMath::Lerp(System.AverageMs, FrameMs, Smoothing);
+		System.AverageCalls = FMath::Lerp(System.AverageCalls, FrameCalls, Smoothing);
+		System.LastTotal = Pair.Value;
+	}
+}
+
+void FGGJPerfOverlay::Draw(UCanvas* Canvas, APlayerController* PC)
+{
+	using namespace GGJPerfOverlay;
+
+	UWorld* World = PC ? PC->GetWorld() : nullptr;
+	if (!Canvas || !World) return;
+
+	SampleTimings();
+
+	TArray<FString, TInlineAllocator<32>> Lines;
+	Lines.Add(FString::Printf(TEXT("GGJ perf    game thread %.2f ms"), AverageGameThreadMs));
+
+	if (const UEnemySpawnerManager* Spawner = World->GetSubsystem<UEnemySpawnerManager>())
+	{
+		const float NextSpawn = Spawner->GetTimeUntilNextSpawn();
+		Lines.Add(FString::Printf(TEXT("Enemies     %d active / %d max, pooled %s, %d spawned"),
+			Spawner->GetNumActiveEnemies(), Spawner->GetMaxEnemies(),
+			Spawner->HasPool() ? *FString::FromInt(Spawner->GetNumPooled()) : TEXT("n/a"), Spawner->GetNumSpawned()));
+		Lines.Add(FString::Printf(TEXT("Headroom    %d below max, next spawn %s"),
+			FMath::Max(0, Spawner->GetMaxEnemies() - Spawner->GetNumActiveEnemies()),
+			NextSpawn >= 0.0f ? *FString::Printf(TEXT("%.1f s"), NextSpawn) : TEXT("off")));
+	}
+
+	if (const UEnemyAttackManager* AttackManager = World->GetSubsystem<UEnemyAttackManager>())
+	{
+		Lines.Add(FString::Printf(TEXT("Tokens      %d / %d"), AttackManager->GetNumTokenHolders(), AttackManager->GetMaxTokens()));
+	}
+
+	Lines.Add(FString::Printf(TEXT("Masks       %d in flight"), AMaskPickup::GetNumInFlight(World)));
+
+	if (const UEnemyPathBroker* PathBroker = World->GetSubsystem<UEnemyPathBroker>())
+	{
+		const FEnemyPathBrokerStats Stats = PathBroker->GetStats();
+		Lines.Add(FString::Printf(TEXT("Paths       %d queued, %d in flight, %.1f ms latency"), Stats.QueueDepth, Stats.InFlight, Stats.AverageLatencyMs));
+	}
+
+	const UEnemySteeringSubsystem* Steering = World->GetSubsystem<UEnemySteeringSubsystem>();
+	const UEnemyAnimBudgetSubsystem* AnimBudget = World->GetSubsystem<UEnemyAnimBudgetSubsystem>();
+	if (Steering || AnimBudget)
+	{
+		const FEnemyAnimBudgetStats AnimStats = AnimBudget ? AnimBudget->GetStats() : FEnemyAnimBudgetStats();
+		Lines.Add(FString::Printf(TEXT("Crowd       %d steering agents, anim %d evaluated / %d registered, %d frozen"),
+			Steering ? Steering->GetNumAgents() : 0, AnimStats.Evaluated, AnimStats.Registered, AnimStats.Frozen));
+	}
+
+	// Most expensive systems first
+	TArray<TPair<FName, FSystemTiming>, TInlineAllocator<16>> Sorted;
+	for (const TPair<FName, FSystemTiming>& Pair : Systems)
+	{
+		Sorted.Emplace(Pair.Key, Pair.Value);
+	}
+	Sorted.Sort([](const TPair<FName, FSystemTiming>& A, const TPair<FName, FSystemTiming>& B) { return A.Value.AverageMs > B.Value.AverageMs; });
+
+	for (const TPair<FName, FSystemTiming>& Pair : Sorted)
+	{
+		FString Name = Pair.Key.ToString();
+		Name.RemoveFromStart(TEXT("STAT_GGJ"));
+		Lines.Add(FString::Printf(TEXT("  %-20s %6.3f ms  %5.1f calls"), *Name, Pair.Value.AverageMs, Pair.Value.AverageCalls));
+	}
+
+	UFont* Font = GEngine->GetSmallFont();
+	const float LineHeight = Font->GetMaxCharHeight() + 2.0f;
+	float Y = 0.15f * Canvas->ClipY;
+
+	Canvas->SetDrawColor(FColor::White);
+	for (const FString& Line : Lines)
+	{
+		Canvas->DrawText(Font, Line, 20.0f, Y);
+		Y += LineHeight;
+	}
+}
+
+static FAutoConsoleCommand GPerfOverlayCommand(
+	TEXT("ggj.perf"),
+	TEXT("Toggle the GGJ performance overlay: enemy counts, masks, path queue, crowd agents and game thread ms per system. ggj.perf 0/1 sets it."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FGGJPerfOverlay::SetVisible(Args.Num() > 0 ? FCString::Atoi(*Args[0]) != 0 : !FGGJPerfOverlay::IsVisible());
+	}));
+#endif
@@ -3,6 +3,7 @@
 
 #include "Dialogue/DialogueActor.h"
 
+#include "Game/GGJStats.h"
 #include "Kismet/GameplayStatics.h"
 
 // Sets default values
@@ -15,6 +16,8 @@ ADialogueActor::ADialogueActor()
 // Called when the game starts or when spawned
 void ADialogueActor::BeginPlay()
 {
+	LLM_SCOPE_BYTAG(GGJ_Dialogue);
+	
 	Super::BeginPlay();
 }
 
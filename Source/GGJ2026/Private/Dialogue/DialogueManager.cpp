@@ -5,6 +5,7 @@
 
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Game/GGJStats.h"
 #include "UI/TextBox.h"
 
 // Sets default values
@@ -17,6 +18,8 @@ ADialogueManager::ADialogueManager()
 // Called when the game starts or when spawned
 void ADialogueManager::BeginPlay()
 {
+	LLM_SCOPE_BYTAG(GGJ_Dialogue);
+	
 	Super::BeginPlay();
 	
 	DialogueWidget = Cast<UWidgetComponent>(GetComponentByClass(UWidgetComponent::StaticClass()));
@@ -35,6 +38,8 @@ void ADialogueManager::Tick(float DeltaTime)
 
 void ADialogueManager::StartDialogue(AActor* InstigatorActor, const FSequenceStruct& SequenceStruct)
 {
+	LLM_SCOPE_BYTAG(GGJ_Dialogue);
+	
 	if (DialogueWidget)
 	{
 		if (DialogueWidget->bHiddenInGame)
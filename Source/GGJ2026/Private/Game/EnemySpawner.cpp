@@ -3,7 +3,7 @@
 
 #include "Game/EnemySpawner.h"
 
-#include "Kismet/KismetMathLibrary.h"
+#include "AI/EnemySpawnerManager.h"
 
 // Sets default values
 AEnemySpawner::AEnemySpawner()
@@ -16,12 +16,18 @@ AEnemySpawner::AEnemySpawner()
 void AEnemySpawner::BeginPlay()
 {
 	Super::BeginPlay();
+	
+	if (const UEnemySpawnerManager* SpawnerManager = GetWorld()->GetSubsystem<UEnemySpawnerManager>())
+	{
+		SetRandomSeed(SpawnerManager->GetSpawnerSeed(this));
+	}
 }
 
 FVector AEnemySpawner::GetSpawnLocation()
 {
-	FVector RandomLocation = UKismetMathLibrary::RandomPointInBoundingBox(GetActorLocation(), FVector(BoxHalfSize, BoxHalfSize, BoxHalfSize));
-	RandomLocation.Z = GetActorLocation().Z;
+	FVector RandomLocation = GetActorLocation();
+	RandomLocation.X += Random.FRandRange(-BoxHalfSize, BoxHalfSize);
+	RandomLocation.Y += Random.FRandRange(-BoxHalfSize, BoxHalfSize);
 	return RandomLocation;
 }
 
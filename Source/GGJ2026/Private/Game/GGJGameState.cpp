@@ -3,6 +3,9 @@
 
 #include "Game/GGJGameState.h"
 
+#include "Debug/FlightRecorder.h"
+#include "Debug/Heatmap.h"
+
 void AGGJGameState::BeginPlay()
 {
 	Super::BeginPlay();
@@ -16,15 +19,27 @@ void AGGJGameState::InitializeGame()
 	// Ensure any existing timer is cleared before starting a new one
 	GetWorld()->GetTimerManager().ClearTimer(GameTimeHandle);
 	GetWorld()->GetTimerManager().SetTimer(GameTimeHandle,this, &AGGJGameState::UpdateGameTime, 1.0f, true);
+
+	if (UHeatmapSubsystem* Heatmaps = GetWorld()->GetSubsystem<UHeatmapSubsystem>())
+	{
+		Heatmaps->BeginMatch();
+	}
 }
 
 void AGGJGameState::UpdateGameTime()
 {
+	GGJ_FLIGHT_TIMER(UpdateGameTime);
+
 	CurrentGameTime += 1.0f;
 
 	if (CurrentGameTime >= MaxGameTime)
 	{
 		GetWorld()->GetTimerManager().ClearTimer(GameTimeHandle);
+
+		if (UHeatmapSubsystem* Heatmaps = GetWorld()->GetSubsystem<UHeatmapSubsystem>())
+		{
+			Heatmaps->FinishMatch();
+		}
 		OnGameTimeEnded();
 	}
 }
@@ -9,6 +9,8 @@
 #include "Engine/GameViewportClient.h"
 #include "Camera/SharedCamera.h"
 #include "Characters/GGJCharacter.h"
+#include "Debug/CombatTelemetry.h"
+#include "Debug/ObjectAccounting.h"
 
 AGGJGamemode::AGGJGamemode()
 {
@@ -20,6 +22,20 @@ void AGGJGamemode::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// High-water marks cover one match
+	FGGJObjectAccounting& Accounting = FGGJObjectAccounting::Get();
+	if (!Accounting.IsRunning() && FParse::Param(FCommandLine::Get(), TEXT("GGJObjectAccounting")))
+	{
+		Accounting.Start();
+	}
+	Accounting.ResetHighWater();
+
+	// One telemetry file per match
+	if (FParse::Param(FCommandLine::Get(), TEXT("GGJCombatTelemetry")))
+	{
+		FGGJCombatTelemetry::Start();
+	}
+
 	// Assign Shared Camera to the primary player on start
 	if (APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0))
 	{
@@ -27,6 +43,21 @@ void AGGJGamemode::BeginPlay()
 	}
 }
 
+void AGGJGamemode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (FGGJObjectAccounting::Get().IsRunning())
+	{
+		FGGJObjectAccounting::Get().LogReport();
+	}
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("GGJCombatTelemetry")))
+	{
+		FGGJCombatTelemetry::Stop();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AGGJGamemode::AddScore(int32 Amount)
 {
 	TotalScore += Amount;
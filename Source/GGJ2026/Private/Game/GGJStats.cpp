@@ -0,0 +1,87 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/GGJStats.h"
+
+DEFINE_STAT(STAT_GGJPlayerTick);
+DEFINE_STAT(STAT_GGJFindBestTarget);
+DEFINE_STAT(STAT_GGJHitboxOverlap);
+DEFINE_STAT(STAT_GGJResolveHits);
+DEFINE_STAT(STAT_GGJEnemyTick);
+DEFINE_STAT(STAT_GGJSpawnEnemy);
+DEFINE_STAT(STAT_GGJCameraUpdate);
+DEFINE_STAT(STAT_GGJCameraClamp);
+DEFINE_STAT(STAT_GGJAIController);
+DEFINE_STAT(STAT_GGJPathBroker);
+DEFINE_STAT(STAT_GGJSteering);
+DEFINE_STAT(STAT_GGJHitboxSweep);
+DEFINE_STAT(STAT_GGJTakeDamage);
+DEFINE_STAT(STAT_GGJFlushDamage);
+
+DEFINE_STAT(STAT_GGJActiveEnemies);
+DEFINE_STAT(STAT_GGJEnemyPoolSize);
+DEFINE_STAT(STAT_GGJTokenHolders);
+DEFINE_STAT(STAT_GGJMasksInFlight);
+
+DEFINE_STAT(STAT_GGJHits);
+
+CSV_DEFINE_CATEGORY_MODULE(GGJ2026_API, GGJ, true);
+
+DEFINE_LOG_CATEGORY(LogGGJCombat);
+DEFINE_LOG_CATEGORY(LogGGJHeatmap);
+DEFINE_LOG_CATEGORY(LogGGJFlightRecorder);
+DEFINE_LOG_CATEGORY(LogGGJCollision);
+
+// Parent of every tag below
+LLM_DEFINE_TAG(GGJ);
+LLM_DEFINE_TAG(GGJ_Enemies, NAME_None, TEXT("GGJ"));
+LLM_DEFINE_TAG(GGJ_AI, NAME_None, TEXT("GGJ"));
+LLM_DEFINE_TAG(GGJ_Masks, NAME_None, TEXT("GGJ"));
+LLM_DEFINE_TAG(GGJ_Dialogue, NAME_None, TEXT("GGJ"));
+LLM_DEFINE_TAG(GGJ_UI, NAME_None, TEXT("GGJ"));
+LLM_DEFINE_TAG(GGJ_Camera, NAME_None, TEXT("GGJ"));
+
+#if !UE_BUILD_SHIPPING
+bool FGGJStatTimings::bRecording = false;
+
+static TMap<FName, FGGJStatTimings::FEntry> GGJStatTimingTotals;
+
+void FGGJStatTimings::Start()
+{
+	check(IsInGameThread());
+	GGJStatTimingTotals.Reset();
+	bRecording = true;
+}
+
+void FGGJStatTimings::Stop()
+{
+	bRecording = false;
+}
+
+void FGGJStatTimings::Add(const FName& StatName, double Seconds)
+{
+	FEntry& Entry = GGJStatTimingTotals.FindOrAdd(StatName);
+	Entry.Seconds += Seconds;
+	Entry.Calls++;
+}
+
+const TMap<FName, FGGJStatTimings::FEntry>& FGGJStatTimings::GetTotals()
+{
+	return GGJStatTimingTotals;
+}
+#endif
+
+#if GGJ_TRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(GGJCombatChannel);
+UE_TRACE_CHANNEL_DEFINE(GGJAIChannel);
+UE_TRACE_CHANNEL_DEFINE(GGJSpawnChannel);
+UE_TRACE_CHANNEL_DEFINE(GGJCameraChannel);
+#endif
+
+#if GGJ_COUNTERS_TRACE_ENABLED
+TRACE_DECLARE_INT_COUNTER(GGJActiveEnemies, TEXT("GGJ/Active Enemies"));
+TRACE_DECLARE_INT_COUNTER(GGJEnemyPoolSize, TEXT("GGJ/Enemy Pool Size"));
+TRACE_DECLARE_INT_COUNTER(GGJTokenHolders, TEXT("GGJ/Attack Token Holders"));
+TRACE_DECLARE_INT_COUNTER(GGJMasksInFlight, TEXT("GGJ/Masks In Flight"));
+TRACE_DECLARE_INT_COUNTER(GGJHitsPerFrame, TEXT("GGJ/Hits Per Frame"));
+#endif
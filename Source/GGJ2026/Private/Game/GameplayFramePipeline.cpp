@@ -0,0 +1,444 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/GameplayFramePipeline.h"
+
+#include "PaperFlipbookComponent.h"
+#include "AI/EnemyManager.h"
+#include "Characters/EnemyCharacter.h"
+#include "Characters/GGJCharacter.h"
+#include "Debug/CombatTelemetry.h"
+#include "Debug/FlightRecorder.h"
+#include "Game/GGJStats.h"
+#include "Components/BoxComponent.h"
+#include "GameFramework/DamageType.h"
+#include "Kismet/GameplayStatics.h"
+#include "Tasks/Task.h"
+
+void UGameplayFramePipeline::Deinitialize()
+{
+	Players.Empty();
+	Enemies.Empty();
+	FramePlayers.Empty();
+	FrameEnemies.Empty();
+	PublishedEnemyResults.Empty();
+	PendingDamage.Empty();
+	PendingNotifies.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UGameplayFramePipeline::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGameplayFramePipeline, STATGROUP_Tickables);
+}
+
+void UGameplayFramePipeline::RegisterPlayer(AGGJCharacter* Player)
+{
+	if (Player)
+	{
+		Players.AddUnique(Player);
+		Player->bDrivenByFramePipeline = true;
+	}
+}
+
+void UGameplayFramePipeline::UnregisterPlayer(AGGJCharacter* Player)
+{
+	if (Player)
+	{
+		Players.RemoveSwap(Player);
+		Player->bDrivenByFramePipeline = false;
+	}
+}
+
+void UGameplayFramePipeline::RegisterEnemy(AEnemyCharacter* Enemy)
+{
+	if (Enemy)
+	{
+		Enemies.AddUnique(Enemy);
+		Enemy->bDrivenByFramePipeline = true;
+	}
+}
+
+void UGameplayFramePipeline::UnregisterEnemy(AEnemyCharacter* Enemy)
+{
+	if (Enemy)
+	{
+		Enemies.RemoveSwap(Enemy);
+		PublishedEnemyResults.Remove(Enemy);
+		Enemy->bDrivenByFramePipeline = false;
+	}
+}
+
+void UGameplayFramePipeline::Tick(float DeltaTime)
+{
+	GGJ_TRACE_COUNTER_SET(HitsPerFrame, HitsThisFrame);
+	HitsThisFrame = 0;
+
+	if (Players.Num() == 0 && Enemies.Num() == 0) return;
+
+	// --- Gather (Game Thread) ---
+	GatherFrame();
+
+	// --- Sense / Steer / Decide (Worker Threads, snapshot only) ---
+	UE::Tasks::FTask SenseTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this] { SenseTargets(); });
+	UE::Tasks::FTask FacingTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this] { ComputeFacings(); });
+	UE::Tasks::FTask SlotTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this] { ScoreAttackSlots(); }, UE::Tasks::Prerequisites(SenseTask, FacingTask));
+
+	// --- Hit Resolution / Damage (Game Thread, overlaps the tasks above) ---
+	ResolveHits();
+	FlushDamage();
+
+	SlotTask.Wait();
+
+	// --- Presentation (Game Thread) ---
+	ApplyFrame();
+}
+
+void UGameplayFramePipeline::GatherFrame()
+{
+	FramePlayers.Reset();
+	PlayerSnapshots.Reset();
+
+	for (AGGJCharacter* Player : Players)
+	{
+		if (!IsValid(Player)) continue;
+
+		FCharacterSnapshot& Snapshot = PlayerSnapshots.AddDefaulted_GetRef();
+		Snapshot.Location = Player->GetActorLocation();
+		Snapshot.Velocity = Player->GetVelocity();
+		Snapshot.LastFacingDirection = Player->LastFacingDirection;
+		Snapshot.CameraYaw = Player->GetCameraRotation().Yaw;
+		Snapshot.bTargetable = Player->ActionState != ECharacterActionState::Dead;
+		FramePlayers.Add(Player);
+	}
+
+	FrameEnemies.Reset();
+	EnemySnapshots.Reset();
+
+	const UEnemyAttackManager* AttackManager = GetWorld()->GetSubsystem<UEnemyAttackManager>();
+	FreeAttackSlots = AttackManager ? FMath::Max(0, AttackManager->GetMaxTokens() - AttackManager->GetNumTokenHolders()) : 0;
+
+	// Every enemy is seen through player 0's camera, no need to look it up per enemy
+	float EnemyCameraYaw = 0.0f;
+	bool bHasEnemyCameraYaw = false;
+
+	for (AEnemyCharacter* Enemy : Enemies)
+	{
+		if (!IsValid(Enemy)) continue;
+
+		if (!bHasEnemyCameraYaw)
+		{
+			EnemyCameraYaw = Enemy->GetCameraRotation().Yaw;
+			bHasEnemyCameraYaw = true;
+		}
+
+		FCharacterSnapshot& Snapshot = EnemySnapshots.AddDefaulted_GetRef();
+		Snapshot.Location = Enemy->GetActorLocation();
+		Snapshot.Velocity = Enemy->GetVelocity();
+		Snapshot.LastFacingDirection = Enemy->LastFacingDirection;
+		Snapshot.CameraYaw = EnemyCameraYaw;
+		Snapshot.bTargetable = !Enemy->IsHidden();
+		Snapshot.bHoldsAttackToken = AttackManager && AttackManager->HasToken(Enemy);
+		FrameEnemies.Add(Enemy);
+	}
+
+	PlayerFacings.SetNum(FramePlayers.Num());
+	EnemyFacings.SetNum(FrameEnemies.Num());
+	EnemyTargets.SetNum(FrameEnemies.Num());
+	EnemyTargetDistances.SetNum(FrameEnemies.Num());
+	EnemySlotScores.SetNum(FrameEnemies.Num());
+}
+
+void UGameplayFramePipeline::SenseTargets()
+{
+	const float SenseRadiusSq = SenseRadius * SenseRadius;
+
+	for (int32 i = 0; i < EnemySnapshots.Num(); ++i)
+	{
+		int32 BestPlayer = INDEX_NONE;
+		float BestDistSq = SenseRadiusSq;
+
+		for (int32 p = 0; p < PlayerSnapshots.Num(); ++p)
+		{
+			if (!PlayerSnapshots[p].bTargetable) continue;
+
+			const float DistSq = FVector::DistSquared2D(EnemySnapshots[i].Location, PlayerSnapshots[p].Location);
+			if (DistSq < BestDistSq)
+			{
+				BestDistSq = DistSq;
+				BestPlayer = p;
+			}
+		}
+
+		EnemyTargets[i] = BestPlayer;
+		EnemyTargetDistances[i] = BestPlayer != INDEX_NONE ? FMath::Sqrt(BestDistSq) : 0.0f;
+	}
+}
+
+void UGameplayFramePipeline::ComputeFacings()
+{
+	for (int32 i = 0; i < PlayerSnapshots.Num(); ++i)
+	{
+		const FCharacterSnapshot& Snapshot = PlayerSnapshots[i];
+		FFacingResult& Result = PlayerFacings[i];
+		ComputeFacing(Snapshot.Velocity, Snapshot.LastFacingDirection, Snapshot.CameraYaw, Result.FacingDirection, Result.AnimDirection, Result.bFlipped);
+	}
+
+	for (int32 i = 0; i < EnemySnapshots.Num(); ++i)
+	{
+		const FCharacterSnapshot& Snapshot = EnemySnapshots[i];
+		FFacingResult& Result = EnemyFacings[i];
+		ComputeFacing(Snapshot.Velocity, Snapshot.LastFacingDirection, Snapshot.CameraYaw, Result.FacingDirection, Result.AnimDirection, Result.bFlipped);
+	}
+}
+
+void UGameplayFramePipeline::ScoreAttackSlots()
+{
+	SlotCandidates.Reset();
+
+	for (int32 i = 0; i < EnemySnapshots.Num(); ++i)
+	{
+		const int32 Target = EnemyTargets[i];
+		if (Target == INDEX_NONE || !EnemySnapshots[i].bTargetable)
+		{
+			EnemySlotScores[i] = 0.0f;
+			continue;
+		}
+
+		// Close enemies that already face their target make the best attackers
+		const float Proximity = 1.0f - FMath::Clamp(EnemyTargetDistances[i] / SenseRadius, 0.0f, 1.0f);
+		const FVector ToTarget = (PlayerSnapshots[Target].Location - EnemySnapshots[i].Location).GetSafeNormal2D();
+		const float Facing = (FVector::DotProduct(EnemyFacings[i].FacingDirection, ToTarget) + 1.0f) * 0.5f;
+
+		EnemySlotScores[i] = Proximity * 0.75f + Facing * 0.25f;
+
+		if (!EnemySnapshots[i].bHoldsAttackToken) SlotCandidates.Add(i);
+	}
+
+	// Only the best few compete for the free tokens
+	SlotCandidates.Sort([this](int32 A, int32 B) { return EnemySlotScores[A] > EnemySlotScores[B]; });
+	SlotCandidates.SetNum(FMath::Min(SlotCandidates.Num(), FreeAttackSlots));
+}
+
+void UGameplayFramePipeline::ResolveHits()
+{
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJResolveHits, Combat);
+
+	TGuardValue<bool> ResolvingGuard(bResolvingHits, true);
+
+	// Hitboxes activated by this frame's notifies resolve this frame
+	FlushEnemyNotifies();
+
+	// Sweep every active hitbox, then resolve all hits in the order they happened within the frame
+	struct FTimedHit
+	{
+		AGGJCharacter* Player = nullptr;
+		AEnemyCharacter* Enemy = nullptr;
+		FHitResult Hit;
+	};
+
+	TArray<FTimedHit> TimedHits;
+	TArray<FHitResult> Hits;
+
+	for (AGGJCharacter* Player : FramePlayers)
+	{
+		if (!IsValid(Player) || !Player->HitboxSweep.IsActive()) continue;
+
+		Player->HitboxSweep.Sweep(Player->HitboxComponent, Hits);
+		for (const FHitResult& Hit : Hits)
+		{
+			TimedHits.Add({ Player, nullptr, Hit });
+		}
+	}
+
+	for (AEnemyCharacter* Enemy : FrameEnemies)
+	{
+		if (!IsValid(Enemy) || !Enemy->HitboxSweep.IsActive()) continue;
+
+		Enemy->HitboxSweep.Sweep(Enemy->HitboxComponent, Hits);
+		for (const FHitResult& Hit : Hits)
+		{
+			TimedHits.Add({ nullptr, Enemy, Hit });
+		}
+	}
+
+	TimedHits.StableSort([](const FTimedHit& A, const FTimedHit& B) { return A.Hit.Time < B.Hit.Time; });
+
+	for (const FTimedHit& TimedHit : TimedHits)
+	{
+		if (TimedHit.Player)
+		{
+			TimedHit.Player->ResolveHitboxHit(TimedHit.Hit);
+		}
+		else if (IsValid(TimedHit.Enemy))
+		{
+			TimedHit.Enemy->ResolveHitboxHit(TimedHit.Hit);
+		}
+	}
+}
+
+void UGameplayFramePipeline::QueueEnemyNotify(AEnemyCharacter* Enemy, ECombatNotifyType Type, FName SocketName, const FVector& Extent)
+{
+	if (!Enemy) return;
+
+	FQueuedNotify& Notify = PendingNotifies.AddDefaulted_GetRef();
+	Notify.Enemy = Enemy;
+	Notify.Type = Type;
+	Notify.SocketName = SocketName;
+	Notify.Extent = Extent;
+}
+
+void UGameplayFramePipeline::FlushEnemyNotifies()
+{
+	TArray<FQueuedNotify> Notifies = MoveTemp(PendingNotifies);
+	PendingNotifies.Reset();
+
+	for (const FQueuedNotify& Notify : Notifies)
+	{
+		AEnemyCharacter* Enemy = Notify.Enemy.Get();
+		if (!Enemy) continue;
+
+		switch (Notify.Type)
+		{
+		case ECombatNotifyType::ActivateHitbox:
+			Enemy->ActivateMeleeHitbox(Notify.SocketName, Notify.Extent);
+			break;
+		case ECombatNotifyType::DeactivateHitbox:
+			Enemy->DeactivateMeleeHitbox();
+			break;
+		case ECombatNotifyType::AttackFinished:
+			Enemy->AttackFinished();
+			break;
+		case ECombatNotifyType::Death:
+			Enemy->FinishDeath();
+			break;
+		}
+	}
+}
+
+void UGameplayFramePipeline::FlushDamage()
+{
+	GGJ_SCOPE_CYCLE_COUNTER(STAT_GGJFlushDamage, Combat);
+
+	// Damage can queue more damage (e.g. on-death effects), so swap before applying
+	TArray<FPendingDamage> Damage = MoveTemp(PendingDamage);
+	PendingDamage.Reset();
+
+	for (const FPendingDamage& Entry : Damage)
+	{
+		if (AActor* Target = Entry.Target.Get())
+		{
+			UGameplayStatics::ApplyDamage(Target, Entry.Amount, Entry.Instigator.Get(), Entry.Causer.Get(), UDamageType::StaticClass());
+		}
+	}
+}
+
+void UGameplayFramePipeline::ApplyFrame()
+{
+	for (int32 i = 0; i < FramePlayers.Num(); ++i)
+	{
+		AGGJCharacter* Player = FramePlayers[i];
+		if (!IsValid(Player)) continue;
+
+		FFacingResult Facing = PlayerFacings[i];
+
+		// Damage this frame (knockdown) may have turned the player after the snapshot was taken
+		if (!Player->LastFacingDirection.Equals(PlayerSnapshots[i].LastFacingDirection))
+		{
+			ComputeFacing(Player->GetVelocity(), Player->LastFacingDirection, PlayerSnapshots[i].CameraYaw, Facing.FacingDirection, Facing.AnimDirection, Facing.bFlipped);
+		}
+
+		Player->LastFacingDirection = Facing.FacingDirection;
+		Player->AnimDirection = Facing.AnimDirection;
+		Player->GetSprite()->SetRelativeScale3D(FVector(Facing.bFlipped ? -1.0f : 1.0f, 1.0f, 1.3f));
+		Player->UpdateDirectionalArrow();
+	}
+
+	PublishedEnemyResults.Reset();
+
+	for (int32 i = 0; i < FrameEnemies.Num(); ++i)
+	{
+		AEnemyCharacter* Enemy = FrameEnemies[i];
+		if (!IsValid(Enemy)) continue;
+
+		const FFacingResult& Facing = EnemyFacings[i];
+		Enemy->LastFacingDirection = Facing.FacingDirection;
+		Enemy->AnimDirection = Facing.AnimDirection;
+		Enemy->GetSprite()->SetRelativeScale3D(FVector(Facing.bFlipped ? -1.0f : 1.0f, 1.0f, 1.3f));
+
+		FEnemyFrameResult& Result = PublishedEnemyResults.Add(Enemy);
+		Result.Target = EnemyTargets[i] != INDEX_NONE ? FramePlayers[EnemyTargets[i]] : nullptr;
+		Result.TargetDistance = EnemyTargetDistances[i];
+		Result.AttackSlotScore = EnemySlotScores[i];
+	}
+
+	for (int32 Candidate : SlotCandidates)
+	{
+		if (FEnemyFrameResult* Result = PublishedEnemyResults.Find(FrameEnemies[Candidate]))
+		{
+			Result->bAttackSlotCandidate = true;
+		}
+	}
+}
+
+void UGameplayFramePipeline::ApplyDamage(AActor* Target, float Amount, AController* Instigator, AActor* Causer)
+{
+	if (!Target) return;
+
+	UWorld* World = Causer ? Causer->GetWorld() : Target->GetWorld();
+	UGameplayFramePipeline* Pipeline = World ? World->GetSubsystem<UGameplayFramePipeline>() : nullptr;
+
+	INC_DWORD_STAT(STAT_GGJHits);
+	CSV_CUSTOM_STAT(GGJ, Hits, 1, ECsvCustomStatOp::Accumulate);
+	GGJ_FLIGHT_EVENT(Damage, Target->GetFName(), Causer ? Causer->GetFName() : NAME_None, Amount);
+	GGJ_COMBAT_EVENT(Damage, Causer, Target, Amount, 0);
+	if (Pipeline) ++Pipeline->HitsThisFrame;
+
+	if (Pipeline && Pipeline->bResolvingHits)
+	{
+		FPendingDamage& Entry = Pipeline->PendingDamage.AddDefaulted_GetRef();
+		Entry.Target = Target;
+		Entry.Amount = Amount;
+		Entry.Instigator = Instigator;
+		Entry.Causer = Causer;
+		return;
+	}
+
+	UGameplayStatics::ApplyDamage(Target, Amount, Instigator, Causer, UDamageType::StaticClass());
+}
+
+void UGameplayFramePipeline::ComputeFacing(const FVector& Velocity, const FVector& LastFacingDirection, float CameraYaw, FVector& OutFacingDirection, float& OutAnimDirection, bool& bOutFlipped)
+{
+	OutFacingDirection = LastFacingDirection;
+
+	// Only update from velocity if moving, otherwise keep the last input direction
+	if (Velocity.SizeSquared2D() > 1.0f)
+	{
+		OutFacingDirection = Velocity.GetSafeNormal2D();
+	}
+
+	// Angle between camera and facing selects the directional animation (Front, Back, Side)
+	OutAnimDirection = FRotator::NormalizeAxis(OutFacingDirection.ToOrientationRotator().Yaw - CameraYaw);
+
+	// DeltaYaw is approx -90 for left (flip), +90 for right (normal)
+	bOutFlipped = OutAnimDirection < -5.0f && OutAnimDirection > -175.0f;
+}
+
+AGGJCharacter* UGameplayFramePipeline::GetSensedTarget(const AEnemyCharacter* Enemy) const
+{
+	const FEnemyFrameResult* Result = PublishedEnemyResults.Find(Enemy);
+	return Result ? Result->Target.Get() : nullptr;
+}
+
+float UGameplayFramePipeline::GetAttackSlotScore(const AEnemyCharacter* Enemy) const
+{
+	const FEnemyFrameResult* Result = PublishedEnemyResults.Find(Enemy);
+	return Result ? Result->AttackSlotScore : 0.0f;
+}
+
+bool UGameplayFramePipeline::IsAttackSlotCandidate(const AEnemyCharacter* Enemy) const
+{
+	const FEnemyFrameResult* Result = PublishedEnemyResults.Find(Enemy);
+	return !Result || Result->bAttackSlotCandidate;
+}
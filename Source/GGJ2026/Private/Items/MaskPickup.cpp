@@ -6,8 +6,24 @@
 #include "Components/BoxComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Camera/CameraVisibilitySubsystem.h"
 #include "Characters/EnemyCharacter.h"
+#include "Game/GGJCollision.h"
+#include "Game/GameplayFramePipeline.h"
+#include "Game/GGJStats.h"
 #include "DrawDebugHelpers.h"
+#include "EngineUtils.h"
+
+int32 AMaskPickup::GetNumInFlight(const UWorld* World)
+{
+	// Only a handful of masks exist at once, counting them beats keeping a per-world tally in sync
+	int32 NumInFlight = 0;
+	for (TActorIterator<AMaskPickup> It(World); It; ++It)
+	{
+		NumInFlight += It->IsFlying() ? 1 : 0;
+	}
+	return NumInFlight;
+}
 
 AMaskPickup::AMaskPickup()
 {
@@ -33,16 +49,10 @@ AMaskPickup::AMaskPickup()
 	DamageVolume->SetupAttachment(RootComponent);
 	DamageVolume->SetBoxExtent(FVector(80.f, 80.f, 80.f));
 	
-	// Use PlayerHitbox channel to ensure detection by enemies
-	DamageVolume->SetCollisionObjectType(ECC_GameTraceChannel3);
+	// PlayerHitbox object type, overlaps enemy hurtboxes and enemy capsules only
+	DamageVolume->SetCollisionProfileName(GGJCollision::MaskDamageProfile);
 	DamageVolume->SetGenerateOverlapEvents(true);
-
 	DamageVolume->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	DamageVolume->SetCollisionResponseToAllChannels(ECR_Ignore);
-	DamageVolume->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-	DamageVolume->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Overlap);
-	// Ensure we hit Enemy Hurtboxes (often on Channel 4)
-	DamageVolume->SetCollisionResponseToChannel(ECC_GameTraceChannel4, ECR_Overlap);
 	DamageVolume->OnComponentBeginOverlap.AddDynamic(this, &AMaskPickup::OnDamageOverlapBegin);
 
 	// Projectile Movement
@@ -57,20 +67,32 @@ AMaskPickup::AMaskPickup()
 
 void AMaskPickup::BeginPlay()
 {
+	LLM_SCOPE_BYTAG(GGJ_Masks);
+
 	Super::BeginPlay();
 
 	// Enforce collision settings to override potential Blueprint changes
 	if (DamageVolume)
 	{
-		DamageVolume->SetCollisionObjectType(ECC_GameTraceChannel3); // PlayerHitbox
-		DamageVolume->SetCollisionResponseToAllChannels(ECR_Ignore);
-		DamageVolume->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-		DamageVolume->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Overlap);
-		DamageVolume->SetCollisionResponseToChannel(ECC_GameTraceChannel4, ECR_Overlap); // EnemyHurtbox
+		// Keep the current enabled state, the profile would reset it to QueryOnly
+		const ECollisionEnabled::Type CollisionEnabled = DamageVolume->GetCollisionEnabled();
+		DamageVolume->SetCollisionProfileName(GGJCollision::MaskDamageProfile);
+		DamageVolume->SetCollisionEnabled(CollisionEnabled);
 		DamageVolume->SetGenerateOverlapEvents(true);
 	}
 }
 
+void AMaskPickup::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bIsFlying)
+	{
+		bIsFlying = false;
+		GGJ_SET_GAUGE(MasksInFlight, GetNumInFlight(GetWorld()));
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AMaskPickup::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -80,14 +102,20 @@ void AMaskPickup::Tick(float DeltaTime)
 		Sprite->AddLocalRotation(FRotator(RotationSpeed * DeltaTime, 0.0f, 0.0f));
 
 		// Check if off-screen to destroy
-		CheckOffScreen();
+		CheckOffScreen(DeltaTime);
 	}
 }
 
 void AMaskPickup::InitializeThrow(FVector Direction, AActor* InShooter)
 {
 	Shooter = InShooter;
-	bIsFlying = true;
+	DamagedActors.Reset();
+	FlightTime = 0.0f;
+	if (!bIsFlying)
+	{
+		bIsFlying = true;
+		GGJ_SET_GAUGE(MasksInFlight, GetNumInFlight(GetWorld()));
+	}
 	
 	// Activate movement
 	ProjectileMovement->Velocity = Direction * 1500.0f; // Throw Speed
@@ -112,37 +140,39 @@ void AMaskPickup::OnDamageOverlapBegin(UPrimitiveComponent* OverlappedComponent,
 	if (!bIsFlying) return;
 	if (OtherActor == this || OtherActor == Shooter) return;
 
-	// Deal damage to enemies
-	if (OtherActor->IsA<AEnemyCharacter>())
+	// Deal damage to enemies, once per throw
+	if (OtherActor->IsA<AEnemyCharacter>() && !DamagedActors.Contains(OtherActor))
 	{
+		DamagedActors.Add(OtherActor);
+
 		if (ThrowDamage <= 0.0f)
 		{
-			UE_LOG(LogTemp, Error, TEXT("Mask Hit Enemy but ThrowDamage is 0! Check Blueprint defaults."));
+			UE_LOG(LogGGJCombat, Error, TEXT("Mask Hit Enemy but ThrowDamage is 0! Check Blueprint defaults."));
 		}
 
-		UGameplayStatics::ApplyDamage(OtherActor, ThrowDamage, Shooter ? Shooter->GetInstigatorController() : nullptr, this, UDamageType::StaticClass());
+		UGameplayFramePipeline::ApplyDamage(OtherActor, ThrowDamage, Shooter ? Shooter->GetInstigatorController() : nullptr, this);
 	}
 }
 
-void AMaskPickup::CheckOffScreen()
+void AMaskPickup::CheckOffScreen(float DeltaTime)
 {
-	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
-	if (!PC) return;
-
-	FVector2D ScreenLoc;
-	int32 SizeX, SizeY;
-	PC->GetViewportSize(SizeX, SizeY);
+	FlightTime += DeltaTime;
 
-	// Project world location to screen
-	if (PC->ProjectWorldLocationToScreen(GetActorLocation(), ScreenLoc))
+	const UCameraVisibilitySubsystem* Visibility = GetWorld()->GetSubsystem<UCameraVisibilitySubsystem>();
+	if (!Visibility || !Visibility->HasView())
 	{
-		// Add a margin so it fully leaves the screen before disappearing
-		float Margin = 100.0f;
-		if (ScreenLoc.X < -Margin || ScreenLoc.X > SizeX + Margin ||
-			ScreenLoc.Y < -Margin || ScreenLoc.Y > SizeY + Margin)
+		// Headless runs would otherwise keep every thrown mask forever
+		if (FlightTime >= HeadlessFlightTime)
 		{
 			Destroy();
 		}
+		return;
+	}
+
+	// Add a margin so it fully leaves the screen before disappearing
+	if (!Visibility->IsOnScreen(GetActorLocation(), OffScreenRadius))
+	{
+		Destroy();
 	}
 }
 
@@ -163,8 +193,13 @@ void AMaskPickup::UpdateVisuals(UPaperFlipbook* RedBook, UPaperFlipbook* GreenBo
 	default: break;
 	}
 
-	if (TargetBook)
+	SetMaskFlipbook(TargetBook);
+}
+
+void AMaskPickup::SetMaskFlipbook(UPaperFlipbook* Book)
+{
+	if (Book)
 	{
-		Sprite->SetFlipbook(TargetBook);
+		Sprite->SetFlipbook(Book);
 	}
 }
\ No newline at end of file
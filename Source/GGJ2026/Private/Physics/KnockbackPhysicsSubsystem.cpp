@@ -0,0 +1,301 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Physics/KnockbackPhysicsSubsystem.h"
+
+#include "PBDRigidsSolver.h"
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+
+static TAutoConsoleVariable<bool> CVarAsyncKnockback(
+	TEXT("ggj.Physics.AsyncKnockback"),
+	false,
+	TEXT("Integrate knockback in a Chaos sim callback instead of launching characters from damage callbacks."));
+
+struct FKnockbackCommand
+{
+	int32 Id = INDEX_NONE;
+	int32 Sequence = 0;
+	FVector Velocity = FVector::ZeroVector;
+};
+
+struct FKnockbackDisplacement
+{
+	int32 Id = INDEX_NONE;
+	FVector Delta = FVector::ZeroVector;
+};
+
+struct FKnockbackSimInput : public Chaos::FSimCallbackInput
+{
+	TArray<FKnockbackCommand> Commands;
+	float Damping = 8.0f;
+
+	void Reset()
+	{
+		Commands.Reset();
+	}
+};
+
+struct FKnockbackSimOutput : public Chaos::FSimCallbackOutput
+{
+	TArray<FKnockbackDisplacement> Displacements;
+
+	void Reset()
+	{
+		Displacements.Reset();
+	}
+};
+
+class FKnockbackSimCallback : public Chaos::TSimCallbackObject<FKnockbackSimInput, FKnockbackSimOutput>
+{
+	/** Physics thread only. */
+	TMap<int32, FVector> Velocities;
+	int32 LastSequence = 0;
+	float Damping = 8.0f;
+
+	virtual void OnPreSimulate_Internal() override
+	{
+		// An input can be seen by several substeps, commands are applied once
+		if (const FKnockbackSimInput* Input = GetConsumerInput_Internal())
+		{
+			Damping = Input->Damping;
+
+			for (const FKnockbackCommand& Command : Input->Commands)
+			{
+				if (Command.Sequence <= LastSequence) continue;
+
+				LastSequence = Command.Sequence;
+				Velocities.Add(Command.Id, Command.Velocity);
+			}
+		}
+
+		if (Velocities.Num() == 0) return;
+
+		const float DeltaTime = GetDeltaTime_Internal();
+		const float Decay = FMath::Exp(-Damping * DeltaTime);
+		FKnockbackSimOutput& Output = GetProducerOutputData_Internal();
+
+		for (auto It = Velocities.CreateIterator(); It; ++It)
+		{
+			// Exact integral of the decaying velocity over the step
+			FKnockbackDisplacement& Displacement = Output.Displacements.AddDefaulted_GetRef();
+			Displacement.Id = It.Key();
+			Displacement.Delta = It.Value() * ((1.0f - Decay) / Damping);
+
+			It.Value() *= Decay;
+			if (It.Value().SizeSquared() < FMath::Square(10.0f))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+};
+
+TStatId UKnockbackPhysicsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UKnockbackPhysicsSubsystem, STATGROUP_Tickables);
+}
+
+void UKnockbackPhysicsSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Registered even while the CVar is off so it can be toggled during play
+	FPhysScene* Scene = InWorld.GetPhysicsScene();
+	if (Scene && Scene->GetSolver())
+	{
+		SimCallback = Scene->GetSolver()->CreateAndRegisterSimCallbackObject_External<FKnockbackSimCallback>();
+	}
+}
+
+void UKnockbackPhysicsSubsystem::Deinitialize()
+{
+	FPhysScene* Scene = GetWorld()->GetPhysicsScene();
+	if (SimCallback && Scene && Scene->GetSolver())
+	{
+		Scene->GetSolver()->UnregisterAndFreeSimCallbackObject_External(SimCallback);
+	}
+	SimCallback = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool UKnockbackPhysicsSubsystem::IsEnabled() const
+{
+	return SimCallback && CVarAsyncKnockback.GetValueOnGameThread();
+}
+
+int32 UKnockbackPhysicsSubsystem::GetOrAddId(APawn* Pawn)
+{
+	if (const int32* Id = PawnIds.Find(Pawn)) return *Id;
+
+	const int32 Id = NextId++;
+	PawnIds.Add(Pawn, Id);
+	IdPawns.Add(Id, Pawn);
+	return Id;
+}
+
+bool UKnockbackPhysicsSubsystem::BeginKnockback(APawn* Pawn)
+{
+	UPawnMovementComponent* Movement = Pawn->GetMovementComponent();
+	if (!Movement) return false;
+
+	// Like LaunchCharacter with XY override: the pawn's own velocity is dropped, and path following
+	// requests are ignored until the knockback ends
+	if (UCharacterMovementComponent* CharacterMovement = Cast<UCharacterMovementComponent>(Movement))
+	{
+		if (CharacterMovement->MovementMode == MOVE_None) return false;
+
+		CharacterMovement->SetMovementMode(MOVE_None);
+		return true;
+	}
+
+	if (!Movement->IsActive()) return false;
+
+	Movement->StopMovementImmediately();
+	Movement->Deactivate();
+	return true;
+}
+
+void UKnockbackPhysicsSubsystem::EndKnockback(APawn* Pawn)
+{
+	UPawnMovementComponent* Movement = Pawn->GetMovementComponent();
+	if (!Movement) return;
+
+	Movement->Velocity = FVector::ZeroVector;
+
+	if (UCharacterMovementComponent* CharacterMovement = Cast<UCharacterMovementComponent>(Movement))
+	{
+		// Someone else may have changed the mode meanwhile, keep theirs
+		if (CharacterMovement->MovementMode == MOVE_None)
+		{
+			CharacterMovement->SetDefaultMovementMode();
+		}
+		return;
+	}
+
+	Movement->Activate();
+}
+
+bool UKnockbackPhysicsSubsystem::QueueKnockback(APawn* Pawn, const FVector& KnockbackVelocity)
+{
+	if (!Pawn) return false;
+
+	UKnockbackPhysicsSubsystem* Subsystem = Pawn->GetWorld()->GetSubsystem<UKnockbackPhysicsSubsystem>();
+	if (!Subsystem || !Subsystem->IsEnabled()) return false;
+
+	FKnockbackSimInput* Input = Subsystem->SimCallback->GetProducerInputData_External();
+	Input->Damping = Subsystem->Damping;
+
+	const int32 Id = Subsystem->GetOrAddId(Pawn);
+	const FVector Velocity(KnockbackVelocity.X, KnockbackVelocity.Y, 0.0f);
+
+	FKnockbackCommand& Command = Input->Commands.AddDefaulted_GetRef();
+	Command.Id = Id;
+	Command.Sequence = ++Subsystem->NextSequence;
+	Command.Velocity = Velocity;
+
+	// The physics thread drops the velocity once it decays below 10
+	FActiveKnockback* Active = Subsystem->ActiveKnockbacks.Find(Id);
+	if (!Active)
+	{
+		Active = &Subsystem->ActiveKnockbacks.Add(Id);
+		Active->bHeldMovement = BeginKnockback(Pawn);
+	}
+	Active->TimeLeft = FMath::Loge(FMath::Max(Velocity.Size(), 10.0f) / 10.0f) / Subsystem->Damping;
+
+	return true;
+}
+
+void UKnockbackPhysicsSubsystem::CancelKnockback(APawn* Pawn)
+{
+	if (!Pawn) return;
+
+	UKnockbackPhysicsSubsystem* Subsystem = Pawn->GetWorld()->GetSubsystem<UKnockbackPhysicsSubsystem>();
+	if (!Subsystem) return;
+
+	int32 Id = INDEX_NONE;
+	if (!Subsystem->PawnIds.RemoveAndCopyValue(Pawn, Id)) return;
+
+	Subsystem->IdPawns.Remove(Id);
+	Subsystem->PendingDisplacements.Remove(Id);
+	Subsystem->ActiveKnockbacks.Remove(Id);
+
+	// A zero velocity replaces whatever still runs for the id, the physics thread drops it on the next step.
+	// Pooled pawns get a new id when they are pushed again, so late outputs for this one are ignored.
+	if (Subsystem->SimCallback)
+	{
+		FKnockbackCommand& Command = Subsystem->SimCallback->GetProducerInputData_External()->Commands.AddDefaulted_GetRef();
+		Command.Id = Id;
+		Command.Sequence = ++Subsystem->NextSequence;
+	}
+}
+
+void UKnockbackPhysicsSubsystem::Tick(float DeltaTime)
+{
+	if (!SimCallback) return;
+
+	// --- Read back (Game Thread) ---
+	while (Chaos::TSimCallbackOutputHandle<FKnockbackSimOutput> Output = SimCallback->PopOutputData_External())
+	{
+		for (const FKnockbackDisplacement& Displacement : Output->Displacements)
+		{
+			PendingDisplacements.FindOrAdd(Displacement.Id) += Displacement.Delta;
+		}
+	}
+
+	// --- Apply (Game Thread) ---
+	for (const TPair<int32, FVector>& Pending : PendingDisplacements)
+	{
+		APawn* Pawn = IdPawns.FindRef(Pending.Key).Get();
+		UPawnMovementComponent* Movement = Pawn ? Pawn->GetMovementComponent() : nullptr;
+		if (!Movement || !Movement->UpdatedComponent) continue;
+
+		// One sweep for the whole frame's displacement
+		FHitResult Hit;
+		Movement->SafeMoveUpdatedComponent(Pending.Value, Movement->UpdatedComponent->GetComponentQuat(), true, Hit);
+
+		// A hit with no XY normal is the floor or a ceiling, there is nothing to slide along
+		const FVector WallNormal = Hit.Normal.GetSafeNormal2D();
+		if (Hit.IsValidBlockingHit() && !WallNormal.IsNearlyZero())
+		{
+			Movement->SlideAlongSurface(Pending.Value, 1.0f - Hit.Time, WallNormal, Hit, true);
+		}
+
+		// Held movement does not compute a velocity, animation reads this one
+		if (DeltaTime > 0.0f)
+		{
+			Movement->Velocity = Pending.Value / DeltaTime;
+		}
+	}
+
+	// Give movement back once the physics thread is done, a frame with no output alone is not enough under substepping
+	for (auto It = ActiveKnockbacks.CreateIterator(); It; ++It)
+	{
+		It.Value().TimeLeft -= DeltaTime;
+		if (It.Value().TimeLeft > 0.0f || PendingDisplacements.Contains(It.Key())) continue;
+
+		APawn* Pawn = IdPawns.FindRef(It.Key()).Get();
+		if (Pawn && It.Value().bHeldMovement)
+		{
+			EndKnockback(Pawn);
+		}
+		It.RemoveCurrent();
+	}
+	PendingDisplacements.Reset();
+
+	// Forget pawns that are gone so the maps do not grow over a session
+	for (auto It = IdPawns.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsValid())
+		{
+			PawnIds.Remove(It.Value());
+			ActiveKnockbacks.Remove(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,113 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Characters/EnemyCharacter.h"
+#include "Components/PrimitiveComponent.h"
+#include "Debug/CollisionAudit.h"
+#include "Debug/PerfCaptureSettings.h"
+#include "Engine/CollisionProfile.h"
+#include "Game/GGJCollision.h"
+#include "Tests/GGJTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCollisionProfileAuditTest, "GGJ.Collision.ProfileAudit",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCollisionProfileAuditTest::RunTest(const FString& Parameters)
+{
+	// Same check as the CollisionAudit commandlet: no GGJ profile may overlap its own object type
+	TArray<FString> Lines;
+	const int32 SelfPairs = FCollisionAudit::AuditProfiles(TEXT("GGJ"), Lines);
+
+	for (const FString& Line : Lines)
+	{
+		AddInfo(Line);
+	}
+
+	return TestEqual(TEXT("Self-overlapping GGJ collision profiles"), SelfPairs, 0);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCollisionMaskDamageTest, "GGJ.Collision.MaskDamagePerEnemy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCollisionMaskDamageTest::RunTest(const FString& Parameters)
+{
+	// A thrown mask deals damage on every begin overlap with an enemy, so only one component of an enemy may raise one
+	FCollisionResponseTemplate MaskDamage;
+	if (!TestTrue(TEXT("GGJMaskDamage profile exists"), UCollisionProfile::Get()->GetProfileTemplate(GGJCollision::MaskDamageProfile, MaskDamage))) return false;
+
+	UClass* EnemyClass = GetDefault<UPerfCaptureSettings>()->EnemyClass.TryLoadClass<AEnemyCharacter>();
+	if (!TestNotNull(TEXT("Enemy class from PerfCaptureSettings"), EnemyClass)) return false;
+
+	FGGJTestWorld TestWorld(TEXT("GGJMaskDamageWorld"));
+	const AEnemyCharacter* Enemy = TestWorld.World->SpawnActor<AEnemyCharacter>(EnemyClass, FVector(0.0f, 0.0f, 100.0f), FRotator::ZeroRotator);
+	if (!TestNotNull(TEXT("Enemy"), Enemy)) return false;
+
+	int32 DamagingOverlaps = 0;
+	Enemy->ForEachComponent<UPrimitiveComponent>(false, [&](const UPrimitiveComponent* Primitive)
+	{
+		// Overlap events need query collision and overlap events on both sides, and at least an overlap response from each
+		if (!Primitive->IsQueryCollisionEnabled() || !Primitive->GetGenerateOverlapEvents()) return;
+
+		const ECollisionResponse MaskToPrimitive = MaskDamage.ResponseToChannels.GetResponse(Primitive->GetCollisionObjectType());
+		const ECollisionResponse PrimitiveToMask = Primitive->GetCollisionResponseToChannel(MaskDamage.ObjectType);
+		if (FMath::Min(MaskToPrimitive, PrimitiveToMask) != ECR_Overlap) return;
+
+		AddInfo(FString::Printf(TEXT("Mask damage overlaps %s"), *Primitive->GetName()));
+		++DamagingOverlaps;
+	});
+
+	return TestEqual(TEXT("Components of an enemy a thrown mask begins overlapping"), DamagingOverlaps, 1);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCollisionSpreadPairBudgetTest, "GGJ.Collision.SpreadPairBudget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCollisionSpreadPairBudgetTest::RunTest(const FString& Parameters)
+{
+	// Enemies on a grid over the whole arena, apart from each other as in a running match. Each one should only
+	// pair with the floor; the enemy scaling benchmark covers the crowded case at its spawners.
+	constexpr int32 GridSize = 14;
+	constexpr float ArenaHalfSize = 10000.0f;
+	constexpr int32 BasePairBudget = 64;
+	constexpr int32 MaxPairsPerEnemy = 4;
+
+	UClass* EnemyClass = GetDefault<UPerfCaptureSettings>()->EnemyClass.TryLoadClass<AEnemyCharacter>();
+	if (!TestNotNull(TEXT("Enemy class from PerfCaptureSettings"), EnemyClass)) return false;
+
+	FGGJTestWorld TestWorld(TEXT("GGJSpreadPairWorld"));
+	TestWorld.BuildArena(ArenaHalfSize, 0.0f, 0);
+
+	const float Spacing = 2.0f * ArenaHalfSize / GridSize;
+	int32 NumEnemies = 0;
+	for (int32 X = 0; X < GridSize; ++X)
+	{
+		for (int32 Y = 0; Y < GridSize; ++Y)
+		{
+			const FVector Location(-ArenaHalfSize + (X + 0.5f) * Spacing, -ArenaHalfSize + (Y + 0.5f) * Spacing, 100.0f);
+			NumEnemies += TestWorld.World->SpawnActor<AEnemyCharacter>(EnemyClass, Location, FRotator::ZeroRotator) ? 1 : 0;
+		}
+	}
+	if (!TestEqual(TEXT("Spawned enemies"), NumEnemies, GridSize * GridSize)) return false;
+
+	// Let them land on the floor
+	for (int32 Frame = 0; Frame < 30; ++Frame)
+	{
+		TestWorld.Tick(1.0f / 60.0f);
+	}
+
+	TArray<FCollisionAudit::FPairCount> PairCounts;
+	const int32 OverlapPairs = FCollisionAudit::CountOverlapPairs(TestWorld.World, PairCounts);
+	for (const FCollisionAudit::FPairCount& Count : PairCounts)
+	{
+		AddInfo(FString::Printf(TEXT("%5d  %s <-> %s"), Count.Count, *FCollisionAudit::GetChannelName(Count.A), *FCollisionAudit::GetChannelName(Count.B)));
+	}
+
+	const int32 PairBudget = BasePairBudget + NumEnemies * MaxPairsPerEnemy;
+	return TestTrue(FString::Printf(TEXT("Live overlap pairs %d within budget %d"), OverlapPairs, PairBudget), OverlapPairs <= PairBudget);
+}
+
+#endif
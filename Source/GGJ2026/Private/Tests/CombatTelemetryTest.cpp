@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Debug/CombatTelemetry.h"
+#include "Debug/SpscRing.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatTelemetryEncodingTest, "GGJ.Telemetry.CombatEncoding",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCombatTelemetryEncodingTest::RunTest(const FString& Parameters)
+{
+	// Ring: fills up, refuses the next item, then hands everything back in order
+	TUniquePtr<TGGJSpscRing<int32, 8>> Ring = MakeUnique<TGGJSpscRing<int32, 8>>();
+	for (int32 i = 0; i < 8; ++i)
+	{
+		TestTrue(TEXT("Push into a ring with room"), Ring->Push(i));
+	}
+	TestFalse(TEXT("Push into a full ring"), Ring->Push(8));
+
+	int32 Popped = INDEX_NONE;
+	for (int32 i = 0; i < 8; ++i)
+	{
+		TestTrue(TEXT("Pop from a non-empty ring"), Ring->Pop(Popped) && Popped == i);
+	}
+	TestFalse(TEXT("Pop from an empty ring"), Ring->Pop(Popped));
+
+	// Encoding: ids jumping both ways, repeated ids, long and zero gaps
+	const uint64 StartCycles = 1000000;
+	TArray<FGGJCombatEvent> Events;
+	const uint32 Ids[][2] = { { 500, 12 }, { 500, 12 }, { 3, 0 }, { 0xFFFFFFF0u, 7 }, { 1, 0xFFFFFFFFu } };
+	uint64 Cycles = StartCycles;
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Ids); ++i)
+	{
+		FGGJCombatEvent& Event = Events.AddDefaulted_GetRef();
+		Cycles += i == 1 ? 0 : static_cast<uint64>(i) << 33;
+		Event.Cycles = Cycles;
+		Event.SourceId = Ids[i][0];
+		Event.TargetId = Ids[i][1];
+		Event.Value = 12.5f * i;
+		Event.Type = static_cast<EGGJCombatEvent>(i % 5);
+		Event.Param = static_cast<uint8>(i * 3);
+	}
+
+	TArray<uint8> Data;
+	FGGJCombatTelemetry::WriteHeader(Data, 1.0e-7, StartCycles);
+	const int32 HeaderSize = Data.Num();
+
+	FGGJCombatTelemetry::FEncoderState State;
+	State.Cycles = StartCycles;
+	for (const FGGJCombatEvent& Event : Events)
+	{
+		FGGJCombatTelemetry::EncodeEvent(Event, State, Data);
+	}
+	AddInfo(FString::Printf(TEXT("%d events in %d bytes, %d raw"), Events.Num(), Data.Num() - HeaderSize, Events.Num() * static_cast<int32>(sizeof(FGGJCombatEvent))));
+
+	FGGJCombatTelemetryFile File;
+	if (!TestTrue(TEXT("Decode"), FGGJCombatTelemetry::Decode(Data, File))) return false;
+
+	TestEqual(TEXT("Start cycles"), File.StartCycles, StartCycles);
+	TestEqual(TEXT("Seconds per cycle"), File.SecondsPerCycle, 1.0e-7);
+	if (!TestEqual(TEXT("Event count"), File.Events.Num(), Events.Num())) return false;
+
+	for (int32 i = 0; i < Events.Num(); ++i)
+	{
+		const FGGJCombatEvent& Expected = Events[i];
+		const FGGJCombatEvent& Actual = File.Events[i];
+		const bool bSame = Expected.Cycles == Actual.Cycles && Expected.SourceId == Actual.SourceId && Expected.TargetId == Actual.TargetId
+			&& Expected.Value == Actual.Value && Expected.Type == Actual.Type && Expected.Param == Actual.Param;
+		TestTrue(FString::Printf(TEXT("Event %d round trip"), i), bSame);
+	}
+
+	// A file cut mid-event keeps the complete events before it
+	Data.SetNum(Data.Num() - 2);
+	TestFalse(TEXT("Decode truncated"), FGGJCombatTelemetry::Decode(Data, File));
+	TestEqual(TEXT("Events before the truncation"), File.Events.Num(), Events.Num() - 1);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,222 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "EngineUtils.h"
+#include "AI/EnemySpawnerManager.h"
+#include "Characters/EnemyCharacter.h"
+#include "Characters/GGJCharacter.h"
+#include "Debug/CollisionAudit.h"
+#include "Debug/PerfCaptureSettings.h"
+#include "Debug/PerfCaptureSubsystem.h"
+#include "Dom/JsonObject.h"
+#include "Game/GameplayFramePipeline.h"
+#include "Game/GGJCollision.h"
+#include "Game/GGJStats.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "Serialization/JsonSerializer.h"
+#include "Tests/GGJTestWorld.h"
+
+/**
+ * Enemy scaling benchmarks. Each scenario spawns N enemies through UEnemySpawnerManager around a dummy
+ * player in a generated flat arena, lets the real AI, token and damage code run for a fixed number of
+ * frames and writes the per-system GGJ stat timings to Saved/Automation/GGJBenchmarks as JSON.
+ *
+ * The arena has no nav mesh, so path requests fail fast and pathfinding cost is not part of the numbers.
+ *
+ * Each scenario also holds the live collision pairs to a budget that grows linearly with the enemy count.
+ * Crowded enemies touch a few neighbours and the floor; a profile that pairs hurtboxes or hitboxes with
+ * their own type grows quadratically and fails it. This only measures the stacked case: without a nav mesh
+ * the enemies stay crowded around the spawners. GGJ.Collision.SpreadPairBudget checks enemies spread
+ * over the arena.
+ */
+namespace GGJEnemyScaling
+{
+	constexpr float FrameDelta = 1.0f / 60.0f;
+	constexpr int32 MaxSpawnFrames = 1200;
+	constexpr int32 MeasuredFrames = 300;
+	constexpr float ArenaHalfSize = 10000.0f;
+	constexpr float SpawnerRadius = 3000.0f;
+	constexpr int32 NumSpawners = 8;
+	constexpr int32 MaxPairsPerEnemy = 8;
+	constexpr int32 BasePairBudget = 64;
+
+	bool IsCombatVolume(ECollisionChannel Channel)
+	{
+		return Channel == GGJCollision::PlayerHitbox || Channel == GGJCollision::EnemyHurtbox
+			|| Channel == GGJCollision::EnemyHitbox || Channel == GGJCollision::PlayerHurtbox;
+	}
+
+	TSharedRef<FJsonObject> MakeSystemJson(const FGGJStatTimings::FEntry& Entry, int32 Frames)
+	{
+		TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetNumberField(TEXT("TotalMs"), Entry.Seconds * 1000.0);
+		Json->SetNumberField(TEXT("MsPerFrame"), Entry.Seconds * 1000.0 / Frames);
+		Json->SetNumberField(TEXT("Calls"), Entry.Calls);
+		return Json;
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FEnemyScalingBenchmark, "GGJ.Benchmark.EnemyScaling",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FEnemyScalingBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 Count : { 40, 200, 1000 })
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Enemies"), Count));
+		OutTestCommands.Add(FString::Printf(TEXT("%d"), Count));
+
+		// A/B of UEnemyMovementComponent against CharacterMovement
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Enemies Lightweight Movement"), Count));
+		OutTestCommands.Add(FString::Printf(TEXT("%d Lightweight"), Count));
+	}
+}
+
+bool FEnemyScalingBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace GGJEnemyScaling;
+
+	const int32 EnemyCount = FCString::Atoi(*Parameters);
+	const bool bLightweight = Parameters.Contains(TEXT("Lightweight"));
+
+	const UPerfCaptureSettings* Settings = GetDefault<UPerfCaptureSettings>();
+	UClass* EnemyClass = Settings->EnemyClass.TryLoadClass<AEnemyCharacter>();
+	UClass* PlayerClass = Settings->PlayerClass.TryLoadClass<AGGJCharacter>();
+	if (!TestNotNull(TEXT("Enemy class from PerfCaptureSettings"), EnemyClass) || !TestNotNull(TEXT("Player class from PerfCaptureSettings"), PlayerClass)) return false;
+
+	IConsoleVariable* LightweightCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ggj.Enemy.LightweightMovement"));
+	const bool bPreviousLightweight = LightweightCVar && LightweightCVar->GetBool();
+	if (LightweightCVar) LightweightCVar->Set(bLightweight, ECVF_SetByCode);
+	ON_SCOPE_EXIT
+	{
+		if (LightweightCVar) LightweightCVar->Set(bPreviousLightweight, ECVF_SetByCode);
+	};
+
+	FGGJTestWorld Benchmark(TEXT("GGJBenchmarkWorld"));
+	UWorld* World = Benchmark.World;
+	Benchmark.BuildArena(ArenaHalfSize, SpawnerRadius, NumSpawners);
+
+	// The dummy only has to stay alive and be targeted
+	AGGJCharacter* Dummy = World->SpawnActor<AGGJCharacter>(PlayerClass, FVector(0.0f, 0.0f, 100.0f), FRotator::ZeroRotator);
+	if (!TestNotNull(TEXT("Dummy player"), Dummy)) return false;
+	Dummy->MaxHealth = TNumericLimits<float>::Max();
+	Dummy->CurrentHealth = Dummy->MaxHealth;
+
+	UEnemySpawnerManager* Spawner = World->GetSubsystem<UEnemySpawnerManager>();
+	Spawner->SetMaxEnemies(EnemyCount);
+	Spawner->SetMaxActiveEnemies(EnemyCount);
+	Spawner->SetEnemyClass(EnemyClass);
+	// Several spawns per frame, the timer catches up on every tick
+	Spawner->SetSpawnRate(FrameDelta / 8.0f);
+	Spawner->SetSpawnTimer();
+
+	const double SpawnStart = FPlatformTime::Seconds();
+	int32 SpawnFrames = 0;
+	while (Spawner->GetNumActiveEnemies() < EnemyCount && SpawnFrames < MaxSpawnFrames)
+	{
+		Benchmark.Tick(FrameDelta);
+		SpawnFrames++;
+	}
+	const double SpawnSeconds = FPlatformTime::Seconds() - SpawnStart;
+	Spawner->ClearSpawnTimer();
+
+	if (!TestEqual(TEXT("Spawned enemies"), Spawner->GetNumActiveEnemies(), EnemyCount)) return false;
+
+	TArray<AEnemyCharacter*> Enemies;
+	for (TActorIterator<AEnemyCharacter> It(World); It; ++It)
+	{
+		Enemies.Add(*It);
+	}
+
+	// --- Measure ---
+	const int32 HitsPerFrame = EnemyCount / 40 + 1;
+	int32 NextVictim = 0;
+
+	TArray<float> FrameMs;
+	FrameMs.Reserve(MeasuredFrames);
+
+	FGGJStatTimings::Start();
+	for (int32 Frame = 0; Frame < MeasuredFrames; ++Frame)
+	{
+		// Player hits on a rotating set of enemies, through the same path as hitbox overlaps
+		for (int32 i = 0; i < HitsPerFrame && Enemies.Num() > 0; ++i)
+		{
+			AEnemyCharacter* Victim = Enemies[NextVictim++ % Enemies.Num()];
+			if (IsValid(Victim))
+			{
+				UGameplayFramePipeline::ApplyDamage(Victim, KINDA_SMALL_NUMBER, nullptr, Dummy);
+			}
+		}
+
+		const double FrameStart = FPlatformTime::Seconds();
+		Benchmark.Tick(FrameDelta);
+		FrameMs.Add((FPlatformTime::Seconds() - FrameStart) * 1000.0);
+	}
+	FGGJStatTimings::Stop();
+
+	TArray<FCollisionAudit::FPairCount> PairCounts;
+	const int32 OverlapPairs = FCollisionAudit::CountOverlapPairs(World, PairCounts);
+	const int32 PairBudget = BasePairBudget + EnemyCount * MaxPairsPerEnemy;
+	TestTrue(FString::Printf(TEXT("Live overlap pairs %d within budget %d"), OverlapPairs, PairBudget), OverlapPairs <= PairBudget);
+
+	for (const FCollisionAudit::FPairCount& Count : PairCounts)
+	{
+		if (Count.A == Count.B && IsCombatVolume(Count.A))
+		{
+			AddError(FString::Printf(TEXT("%d %s pairs with its own type"), Count.Count, *FCollisionAudit::GetChannelName(Count.A)));
+		}
+	}
+
+	// --- Report ---
+	FrameMs.Sort();
+	double TotalFrameMs = 0.0;
+	for (const float Ms : FrameMs)
+	{
+		TotalFrameMs += Ms;
+	}
+
+	TSharedRef<FJsonObject> Systems = MakeShared<FJsonObject>();
+	for (const TPair<FName, FGGJStatTimings::FEntry>& Pair : FGGJStatTimings::GetTotals())
+	{
+		Systems->SetObjectField(Pair.Key.ToString(), MakeSystemJson(Pair.Value, MeasuredFrames));
+	}
+
+	TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+	Json->SetStringField(TEXT("Scenario"), Parameters);
+	Json->SetNumberField(TEXT("EnemyCount"), EnemyCount);
+	Json->SetBoolField(TEXT("LightweightMovement"), bLightweight);
+	Json->SetStringField(TEXT("BuildVersion"), FApp::GetBuildVersion());
+	Json->SetNumberField(TEXT("Changelist"), FEngineVersion::Current().GetChangelist());
+	Json->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+	Json->SetNumberField(TEXT("SpawnFrames"), SpawnFrames);
+	Json->SetNumberField(TEXT("SpawnMs"), SpawnSeconds * 1000.0);
+	Json->SetNumberField(TEXT("Frames"), MeasuredFrames);
+	Json->SetNumberField(TEXT("FrameMsMean"), TotalFrameMs / MeasuredFrames);
+	Json->SetNumberField(TEXT("FrameMsP50"), UPerfCaptureSubsystem::GetPercentile(FrameMs, 50.0f));
+	Json->SetNumberField(TEXT("FrameMsP95"), UPerfCaptureSubsystem::GetPercentile(FrameMs, 95.0f));
+	Json->SetNumberField(TEXT("FrameMsP99"), UPerfCaptureSubsystem::GetPercentile(FrameMs, 99.0f));
+	Json->SetNumberField(TEXT("LiveOverlapPairs"), OverlapPairs);
+	Json->SetObjectField(TEXT("Systems"), Systems);
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Json, Writer);
+
+	const FString FileName = FString::Printf(TEXT("EnemyScaling-%d%s.json"), EnemyCount, bLightweight ? TEXT("-Lightweight") : TEXT(""));
+	const FString Path = FPaths::ProjectSavedDir() / TEXT("Automation") / TEXT("GGJBenchmarks") / FileName;
+	TestTrue(TEXT("Write results"), FFileHelper::SaveStringToFile(Output, *Path));
+
+	AddInfo(FString::Printf(TEXT("%d enemies%s: mean %.2f ms, p95 %.2f ms, %d overlap pairs -> %s"), EnemyCount, bLightweight ? TEXT(" (lightweight)") : TEXT(""),
+		TotalFrameMs / MeasuredFrames, UPerfCaptureSubsystem::GetPercentile(FrameMs, 95.0f), OverlapPairs, *Path));
+
+	return true;
+}
+
+#endif
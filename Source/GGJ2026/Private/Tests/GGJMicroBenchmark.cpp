@@ -0,0 +1,112 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Tests/GGJMicroBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+
+volatile uint64 FGGJMicroBenchmark::Sink = 0;
+
+namespace GGJMicroBenchmark
+{
+	double Median(TArray<double>& Values)
+	{
+		Values.Sort();
+		const int32 Mid = Values.Num() / 2;
+		return Values.Num() % 2 ? Values[Mid] : (Values[Mid - 1] + Values[Mid]) * 0.5;
+	}
+}
+
+FGGJMicroBenchmark::FGGJMicroBenchmark(const FString& InSuiteName)
+	: SuiteName(InSuiteName)
+{
+}
+
+const FGGJMicroBenchmark::FResult& FGGJMicroBenchmark::Run(const FString& Name, int32 Param, TFunctionRef<void()> Body)
+{
+	for (int32 i = 0; i < WarmupIterations; ++i)
+	{
+		Body();
+	}
+
+	TArray<double> RunNs;
+	RunNs.Reserve(Runs);
+	for (int32 RunIndex = 0; RunIndex < Runs; ++RunIndex)
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 i = 0; i < IterationsPerRun; ++i)
+		{
+			Body();
+		}
+		const uint64 End = FPlatformTime::Cycles64();
+		RunNs.Add(FPlatformTime::ToMilliseconds64(End - Start) * 1.0e6 / IterationsPerRun);
+	}
+
+	FResult& Result = Results.AddDefaulted_GetRef();
+	Result.Name = Name;
+	Result.Param = Param;
+	Result.Iterations = IterationsPerRun;
+	Result.MedianNs = GGJMicroBenchmark::Median(RunNs);
+	Result.MinNs = RunNs[0];
+
+	TArray<double> Deviations;
+	Deviations.Reserve(RunNs.Num());
+	for (const double Ns : RunNs)
+	{
+		Deviations.Add(FMath::Abs(Ns - Result.MedianNs));
+	}
+	Result.MadNs = GGJMicroBenchmark::Median(Deviations);
+
+	return Result;
+}
+
+void FGGJMicroBenchmark::Sweep(const FString& Name, TConstArrayView<int32> Params, TFunctionRef<void(int32 Param)> Body)
+{
+	for (const int32 Param : Params)
+	{
+		Run(Name, Param, [&Body, Param]() { Body(Param); });
+	}
+}
+
+TSharedRef<FJsonObject> FGGJMicroBenchmark::ToJson() const
+{
+	TArray<TSharedPtr<FJsonValue>> Cases;
+	for (const FResult& Result : Results)
+	{
+		TSharedRef<FJsonObject> Case = MakeShared<FJsonObject>();
+		Case->SetStringField(TEXT("Name"), Result.Name);
+		Case->SetNumberField(TEXT("Param"), Result.Param);
+		Case->SetNumberField(TEXT("Iterations"), Result.Iterations);
+		Case->SetNumberField(TEXT("MedianNs"), Result.MedianNs);
+		Case->SetNumberField(TEXT("MadNs"), Result.MadNs);
+		Case->SetNumberField(TEXT("MinNs"), Result.MinNs);
+		Cases.Add(MakeShared<FJsonValueObject>(Case));
+	}
+
+	TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+	Json->SetStringField(TEXT("Suite"), SuiteName);
+	Json->SetStringField(TEXT("BuildVersion"), FApp::GetBuildVersion());
+	Json->SetNumberField(TEXT("Changelist"), FEngineVersion::Current().GetChangelist());
+	Json->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+	Json->SetNumberField(TEXT("Runs"), Runs);
+	Json->SetNumberField(TEXT("WarmupIterations"), WarmupIterations);
+	Json->SetArrayField(TEXT("Cases"), Cases);
+	return Json;
+}
+
+bool FGGJMicroBenchmark::Save(FString& OutPath) const
+{
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(ToJson(), Writer);
+
+	OutPath = FPaths::ProjectSavedDir() / TEXT("Automation") / TEXT("GGJBenchmarks") / FString::Printf(TEXT("Micro-%s.json"), *SuiteName);
+	return FFileHelper::SaveStringToFile(Output, *OutPath);
+}
+
+#endif
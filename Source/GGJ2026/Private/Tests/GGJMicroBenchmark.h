@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Dom/JsonObject.h"
+
+/**
+ * Small harness for timing pure gameplay code without a world. Each case runs warm-up iterations, then a number
+ * of timed runs of a fixed iteration count, and reports the median and the median absolute deviation of the time
+ * per iteration. Results from one suite are written together as JSON next to the scaling benchmarks.
+ */
+class FGGJMicroBenchmark
+{
+public:
+	struct FResult
+	{
+		FString Name;
+
+		/** Value of the swept parameter, e.g. the number of candidates. */
+		int32 Param = 0;
+
+		int32 Iterations = 0;
+
+		double MedianNs = 0.0;
+
+		double MadNs = 0.0;
+
+		double MinNs = 0.0;
+	};
+
+	int32 WarmupIterations = 1000;
+
+	int32 Runs = 31;
+
+	int32 IterationsPerRun = 1000;
+
+	explicit FGGJMicroBenchmark(const FString& InSuiteName);
+
+	/** Times Body, which must do one iteration of the work, and records the result. */
+	const FResult& Run(const FString& Name, int32 Param, TFunctionRef<void()> Body);
+
+	/** Runs Body once per entry of Params, passing the parameter on. */
+	void Sweep(const FString& Name, TConstArrayView<int32> Params, TFunctionRef<void(int32 Param)> Body);
+
+	const TArray<FResult>& GetResults() const { return Results; }
+
+	TSharedRef<FJsonObject> ToJson() const;
+
+	/** Writes Saved/Automation/GGJBenchmarks/Micro-<Suite>.json. */
+	bool Save(FString& OutPath) const;
+
+	/** Keeps a computed value alive so the optimizer cannot drop the work that produced it. */
+	template <typename T>
+	static void DoNotOptimize(const T& Value)
+	{
+		Sink = Sink + static_cast<uint64>(reinterpret_cast<const volatile uint8&>(Value));
+	}
+
+private:
+	FString SuiteName;
+
+	TArray<FResult> Results;
+
+	static volatile uint64 Sink;
+};
+
+#endif
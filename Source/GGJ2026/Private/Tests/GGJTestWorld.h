@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "NavigationSystem.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Game/EnemySpawner.h"
+#include "GameFramework/WorldSettings.h"
+
+/**
+ * A game world for automation tests that ticks without a game mode, torn down with the scope.
+ * A bare game instance owns it so game instance subsystems (enemy archetypes) exist.
+ * There is no nav mesh, so path requests fail immediately.
+ */
+struct FGGJTestWorld
+{
+	UWorld* World = nullptr;
+	UGameInstance* GameInstance = nullptr;
+
+	explicit FGGJTestWorld(const TCHAR* Name)
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, Name);
+		FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+		Context.SetCurrentWorld(World);
+
+		GameInstance = NewObject<UGameInstance>(GEngine);
+		GameInstance->AddToRoot();
+		Context.OwningGameInstance = GameInstance;
+		World->SetGameInstance(GameInstance);
+		GameInstance->Init();
+
+		FNavigationSystem::AddNavigationSystemToWorld(*World, FNavigationSystemRunMode::GameMode);
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+
+		// Normally sent by the game state once the game mode starts play
+		if (!World->HasBegunPlay())
+		{
+			World->GetWorldSettings()->NotifyBeginPlay();
+		}
+	}
+
+	~FGGJTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+
+		GameInstance->Shutdown();
+		GameInstance->RemoveFromRoot();
+	}
+
+	void Tick(float DeltaTime)
+	{
+		++GFrameCounter;
+		World->Tick(LEVELTICK_All, DeltaTime);
+	}
+
+	/** Flat floor of HalfSize around the origin with NumSpawners enemy spawners on a ring. */
+	void BuildArena(float HalfSize, float SpawnerRadius, int32 NumSpawners)
+	{
+		UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+
+		AStaticMeshActor* Floor = World->SpawnActor<AStaticMeshActor>(FVector(0.0f, 0.0f, -50.0f), FRotator::ZeroRotator);
+		Floor->GetStaticMeshComponent()->SetStaticMesh(Cube);
+		Floor->GetStaticMeshComponent()->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		Floor->SetActorScale3D(FVector(HalfSize / 50.0f, HalfSize / 50.0f, 1.0f));
+
+		for (int32 i = 0; i < NumSpawners; ++i)
+		{
+			const float Angle = 2.0f * PI * i / NumSpawners;
+			World->SpawnActor<AEnemySpawner>(FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * SpawnerRadius + FVector(0.0f, 0.0f, 100.0f), FRotator::ZeroRotator);
+		}
+	}
+};
+
+#endif
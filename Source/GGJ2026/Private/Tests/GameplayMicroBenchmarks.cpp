@@ -0,0 +1,204 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AI/EnemyManager.h"
+#include "AI/EnemySpawnerManager.h"
+#include "Camera/CameraFraming.h"
+#include "Characters/GGJCharacter.h"
+#include "Game/GameplayFramePipeline.h"
+#include "GameFramework/Actor.h"
+#include "Tests/GGJMicroBenchmark.h"
+#include "UObject/Package.h"
+
+/**
+ * Microbenchmarks of the world-free parts of hot gameplay routines. Each suite is one test command so it can be
+ * run on its own, and writes Saved/Automation/GGJBenchmarks/Micro-<Suite>.json.
+ */
+namespace GGJMicroBenchmarks
+{
+	const int32 CandidateCounts[] = { 4, 16, 64, 256 };
+	const int32 EnemyCounts[] = { 40, 200, 1000 };
+	const int32 PlayerCounts[] = { 1, 2, 4 };
+
+	/** Points on a disc around the origin, the same every run. */
+	TArray<FVector> MakePoints(int32 Count, float Radius, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector> Points;
+		Points.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const float Angle = Random.FRandRange(0.0f, 2.0f * PI);
+			Points.Add(FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * Random.FRandRange(0.0f, Radius));
+		}
+		return Points;
+	}
+
+	void RunLungeTargeting(FGGJMicroBenchmark& Bench)
+	{
+		TMap<int32, TArray<FVector>> Points;
+		for (const int32 Count : CandidateCounts)
+		{
+			Points.Add(Count, MakePoints(Count, 400.0f, Count));
+		}
+
+		Bench.Sweep(TEXT("SelectLungeTarget"), CandidateCounts, [&Points](int32 Count)
+		{
+			FGGJMicroBenchmark::DoNotOptimize(AGGJCharacter::SelectLungeTarget(FVector::ZeroVector, FVector::ForwardVector, 60.0f, Points[Count]));
+		});
+	}
+
+	void RunSpawnDistribution(FGGJMicroBenchmark& Bench)
+	{
+		TArray<int32> List;
+		Bench.Sweep(TEXT("BuildArchetypeList"), EnemyCounts, [&List](int32 Count)
+		{
+			List.Reset();
+			UEnemySpawnerManager::BuildArchetypeList(Count, nullptr, List);
+			FGGJMicroBenchmark::DoNotOptimize(List.Num());
+		});
+
+		const FRandomStream Stream(1234);
+		Bench.Sweep(TEXT("ShuffleList"), EnemyCounts, [&List, &Stream](int32 Count)
+		{
+			List.SetNumZeroed(Count, EAllowShrinking::No);
+			UEnemySpawnerManager::ShuffleList(List, Stream);
+			FGGJMicroBenchmark::DoNotOptimize(List[0]);
+		});
+	}
+
+	void RunAttackTokens(FGGJMicroBenchmark& Bench)
+	{
+		// Actors are only used as keys, they never need a world
+		TArray<AActor*> Enemies;
+		for (int32 i = 0; i < EnemyCounts[UE_ARRAY_COUNT(EnemyCounts) - 1]; ++i)
+		{
+			Enemies.Add(NewObject<AActor>(GetTransientPackage(), NAME_None, RF_Transient));
+		}
+
+		UEnemyAttackManager* AttackManager = NewObject<UEnemyAttackManager>(GetTransientPackage(), NAME_None, RF_Transient);
+		AttackManager->SetMaxToken(2);
+
+		// Every enemy asks every frame, the holders release and the next ones get the token
+		Bench.Sweep(TEXT("RequestReleaseToken"), EnemyCounts, [&Enemies, AttackManager](int32 Count)
+		{
+			int32 Granted = 0;
+			for (int32 i = 0; i < Count; ++i)
+			{
+				Granted += AttackManager->RequestAttack(Enemies[i]);
+			}
+			for (int32 i = 0; i < Count; ++i)
+			{
+				AttackManager->ReleaseToken(Enemies[i]);
+			}
+			FGGJMicroBenchmark::DoNotOptimize(Granted);
+		});
+
+		for (AActor* Enemy : Enemies)
+		{
+			Enemy->MarkAsGarbage();
+		}
+		AttackManager->MarkAsGarbage();
+	}
+
+	void RunCamera(FGGJMicroBenchmark& Bench)
+	{
+		TMap<int32, TArray<FVector>> Points;
+		for (const int32 Count : PlayerCounts)
+		{
+			Points.Add(Count, MakePoints(Count, 1000.0f, Count));
+		}
+
+		Bench.Sweep(TEXT("ComputeFraming"), PlayerCounts, [&Points](int32 Count)
+		{
+			FVector Center;
+			float Spread;
+			FCameraFraming::ComputeFraming(Points[Count], Center, Spread);
+			FGGJMicroBenchmark::DoNotOptimize(Spread);
+		});
+
+		const FVector2D ViewportSize(1920.0f, 1080.0f);
+		Bench.Run(TEXT("ViewQuad"), 1, [&ViewportSize]()
+		{
+			const FCameraFraming::FViewRays Rays = FCameraFraming::ComputeViewRays(FVector(-1000.0f, 0.0f, 1000.0f), FRotator(-45.0f, 0.0f, 0.0f), 90.0f, ViewportSize, 50.0f);
+			FVector2D Quad[4];
+			FCameraFraming::GetPlaneQuad(Rays, 0.0f, Quad);
+			FGGJMicroBenchmark::DoNotOptimize(FCameraFraming::ClampToQuad(FVector2D(5000.0f, 0.0f), Quad));
+		});
+	}
+
+	void RunMaskDrain(FGGJMicroBenchmark& Bench)
+	{
+		// A full mask drained to empty, one step per simulated second
+		Bench.Run(TEXT("DrainMaskToEmpty"), 1, []()
+		{
+			float Duration = 30.0f;
+			float DrainRate = 1.0f;
+			int32 Seconds = 0;
+			while (Duration > 0.0f)
+			{
+				Duration = AGGJCharacter::DrainMaskDuration(Duration, DrainRate, 0.05f);
+				Seconds++;
+			}
+			FGGJMicroBenchmark::DoNotOptimize(Seconds);
+		});
+	}
+
+	void RunFacing(FGGJMicroBenchmark& Bench)
+	{
+		Bench.Run(TEXT("ComputeFacing"), 1, []()
+		{
+			FVector Facing;
+			float AnimDirection;
+			bool bFlipped;
+			UGameplayFramePipeline::ComputeFacing(FVector(300.0f, 200.0f, 0.0f), FVector::ForwardVector, 30.0f, Facing, AnimDirection, bFlipped);
+			FGGJMicroBenchmark::DoNotOptimize(AnimDirection);
+		});
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FGameplayMicroBenchmarks, "GGJ.Benchmark.Micro",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FGameplayMicroBenchmarks::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const TCHAR* Suite : { TEXT("LungeTargeting"), TEXT("SpawnDistribution"), TEXT("AttackTokens"), TEXT("Camera"), TEXT("MaskDrain"), TEXT("Facing") })
+	{
+		OutBeautifiedNames.Add(Suite);
+		OutTestCommands.Add(Suite);
+	}
+}
+
+bool FGameplayMicroBenchmarks::RunTest(const FString& Parameters)
+{
+	using namespace GGJMicroBenchmarks;
+
+	FGGJMicroBenchmark Bench(Parameters);
+
+	if (Parameters == TEXT("LungeTargeting")) RunLungeTargeting(Bench);
+	else if (Parameters == TEXT("SpawnDistribution")) RunSpawnDistribution(Bench);
+	else if (Parameters == TEXT("AttackTokens")) RunAttackTokens(Bench);
+	else if (Parameters == TEXT("Camera")) RunCamera(Bench);
+	else if (Parameters == TEXT("MaskDrain")) RunMaskDrain(Bench);
+	else if (Parameters == TEXT("Facing")) RunFacing(Bench);
+	else
+	{
+		AddError(FString::Printf(TEXT("Unknown benchmark suite %s"), *Parameters));
+		return false;
+	}
+
+	for (const FGGJMicroBenchmark::FResult& Result : Bench.GetResults())
+	{
+		AddInfo(FString::Printf(TEXT("%s(%d): median %.1f ns, MAD %.1f ns"), *Result.Name, Result.Param, Result.MedianNs, Result.MadNs));
+	}
+
+	FString Path;
+	const bool bSaved = Bench.Save(Path);
+	return TestTrue(FString::Printf(TEXT("Write %s"), *Path), bSaved);
+}
+
+#endif
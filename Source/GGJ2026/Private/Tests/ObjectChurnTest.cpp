@@ -0,0 +1,201 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "EngineUtils.h"
+#include "AI/EnemySpawnerManager.h"
+#include "Characters/EnemyCharacter.h"
+#include "Characters/GGJCharacter.h"
+#include "Characters/Components/HealthComponent.h"
+#include "Debug/ObjectAccounting.h"
+#include "Debug/PerfCaptureSettings.h"
+#include "Game/GameplayFramePipeline.h"
+#include "Items/MaskPickup.h"
+#include "Misc/ScopeExit.h"
+#include "Tests/GGJTestWorld.h"
+
+/**
+ * Ten simulated minutes of enemies spawning, dying and going back through ResetEnemy, with masks thrown,
+ * dropped by dead enemies and destroyed along the way. Once everything is cleared and garbage collected, the live count of every GGJ class
+ * must be back at what it was before the first spawn.
+ */
+namespace GGJObjectChurn
+{
+	constexpr float FrameDelta = 1.0f / 30.0f;
+	constexpr float MatchSeconds = 600.0f;
+	constexpr float KillInterval = 0.5f;
+	constexpr float MaskInterval = 2.0f;
+	constexpr float MaskLifetime = 3.0f;
+	constexpr float GCInterval = 60.0f;
+
+	void FlushGarbage()
+	{
+		::CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+	}
+
+	bool IsDead(const AEnemyCharacter* Enemy)
+	{
+		const UHealthComponent* Health = Enemy->FindComponentByClass<UHealthComponent>();
+		return Health && Health->IsActorDead();
+	}
+
+	/** Stands in for the death animation notify, which does not play in a bare world. */
+	void ResetDeadEnemies(UWorld* World)
+	{
+		TArray<AEnemyCharacter*, TInlineAllocator<16>> Dead;
+		for (TActorIterator<AEnemyCharacter> It(World); It; ++It)
+		{
+			if (IsValid(*It) && IsDead(*It)) Dead.Add(*It);
+		}
+
+		for (AEnemyCharacter* Enemy : Dead)
+		{
+			Enemy->FinishDeath();
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FObjectChurnTest, "GGJ.Memory.ObjectChurn",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::StressFilter)
+
+bool FObjectChurnTest::RunTest(const FString& Parameters)
+{
+	using namespace GGJObjectChurn;
+
+	const UPerfCaptureSettings* Settings = GetDefault<UPerfCaptureSettings>();
+	UClass* EnemyClass = Settings->EnemyClass.TryLoadClass<AEnemyCharacter>();
+	UClass* PlayerClass = Settings->PlayerClass.TryLoadClass<AGGJCharacter>();
+	if (!TestNotNull(TEXT("Enemy class from PerfCaptureSettings"), EnemyClass) || !TestNotNull(TEXT("Player class from PerfCaptureSettings"), PlayerClass)) return false;
+
+	FGGJObjectAccounting& Accounting = FGGJObjectAccounting::Get();
+	const bool bWasRunning = Accounting.IsRunning();
+	Accounting.Start();
+	ON_SCOPE_EXIT
+	{
+		if (!bWasRunning) Accounting.Stop();
+	};
+
+	FGGJTestWorld TestWorld(TEXT("GGJObjectChurnWorld"));
+	UWorld* World = TestWorld.World;
+	TestWorld.BuildArena(5000.0f, 2000.0f, 8);
+
+	AGGJCharacter* Dummy = World->SpawnActor<AGGJCharacter>(PlayerClass, FVector(0.0f, 0.0f, 100.0f), FRotator::ZeroRotator);
+	if (!TestNotNull(TEXT("Dummy player"), Dummy)) return false;
+	Dummy->MaxHealth = TNumericLimits<float>::Max();
+	Dummy->CurrentHealth = Dummy->MaxHealth;
+
+	UEnemySpawnerManager* Spawner = World->GetSubsystem<UEnemySpawnerManager>();
+	Spawner->SetMaxEnemies(40);
+	Spawner->SetMaxActiveEnemies(20);
+	Spawner->SetEnemyClass(EnemyClass);
+	Spawner->SetSpawnRate(0.25f);
+
+	TestWorld.Tick(FrameDelta);
+	FlushGarbage();
+	const TMap<FName, FGGJObjectAccounting::FClassCount> Baseline = Accounting.GetCounts();
+	Accounting.ResetHighWater();
+
+	// --- Churn ---
+	Spawner->SetSpawnTimer();
+
+	TArray<TPair<TWeakObjectPtr<AMaskPickup>, float>> Masks;
+	int32 NumDropped = 0;
+	float Time = 0.0f;
+	float NextKill = KillInterval;
+	float NextMask = MaskInterval;
+	float NextGC = GCInterval;
+
+	const int32 Frames = FMath::CeilToInt(MatchSeconds / FrameDelta);
+	for (int32 Frame = 0; Frame < Frames; ++Frame)
+	{
+		Time += FrameDelta;
+
+		if (Time >= NextKill)
+		{
+			NextKill += KillInterval;
+			for (TActorIterator<AEnemyCharacter> It(World); It; ++It)
+			{
+				if (!IsValid(*It) || IsDead(*It)) continue;
+
+				UGameplayFramePipeline::ApplyDamage(*It, TNumericLimits<float>::Max(), nullptr, Dummy);
+				break;
+			}
+		}
+
+		if (Time >= NextMask)
+		{
+			NextMask += MaskInterval;
+			if (AMaskPickup* Mask = World->SpawnActor<AMaskPickup>(AMaskPickup::StaticClass(), Dummy->GetActorLocation() + FVector(0.0f, 0.0f, 40.0f), FRotator::ZeroRotator))
+			{
+				Mask->MaskType = EEnemyType::RedRabbit;
+				Mask->InitializeThrow(FVector(FMath::Cos(Time), FMath::Sin(Time), 0.0f), Dummy);
+				Masks.Emplace(Mask, Time + MaskLifetime);
+			}
+		}
+
+		// Masks dropped by dead enemies, picked up after the same lifetime
+		for (TActorIterator<AMaskPickup> It(World); It; ++It)
+		{
+			AMaskPickup* Mask = *It;
+			if (!IsValid(Mask) || Mask->IsFlying()) continue;
+			if (Masks.ContainsByPredicate([Mask](const TPair<TWeakObjectPtr<AMaskPickup>, float>& Tracked) { return Tracked.Key == Mask; })) continue;
+
+			Masks.Emplace(Mask, Time + MaskLifetime);
+			++NumDropped;
+		}
+
+		// Masks normally end up caught or picked up
+		Masks.RemoveAll([Time](const TPair<TWeakObjectPtr<AMaskPickup>, float>& Mask)
+		{
+			if (Mask.Key.IsValid() && Time < Mask.Value) return false;
+			if (Mask.Key.IsValid()) Mask.Key->Destroy();
+			return true;
+		});
+
+		TestWorld.Tick(FrameDelta);
+		ResetDeadEnemies(World);
+
+		if (Time >= NextGC)
+		{
+			NextGC += GCInterval;
+			FlushGarbage();
+		}
+	}
+
+	// --- Clear the match ---
+	Spawner->ClearSpawnTimer();
+
+	for (TActorIterator<AEnemyCharacter> It(World); It; ++It)
+	{
+		Spawner->ResetEnemy(*It);
+	}
+	for (TActorIterator<AMaskPickup> It(World); It; ++It)
+	{
+		It->Destroy();
+	}
+
+	TestWorld.Tick(FrameDelta);
+	FlushGarbage();
+
+	AddInfo(FString::Printf(TEXT("%d enemies spawned, %d masks dropped over %.0f simulated seconds"), Spawner->GetNumSpawned(), NumDropped, MatchSeconds));
+
+	const TMap<FName, FGGJObjectAccounting::FClassCount> Final = Accounting.GetCounts();
+	for (const TPair<FName, FGGJObjectAccounting::FClassCount>& Pair : Final)
+	{
+		const FGGJObjectAccounting::FClassCount* Before = Baseline.Find(Pair.Key);
+		const int32 BaselineLive = Before ? Before->Live : 0;
+
+		AddInfo(FString::Printf(TEXT("%s: live %d (baseline %d), high-water %d, created %d"), *Pair.Key.ToString(), Pair.Value.Live, BaselineLive, Pair.Value.HighWater, Pair.Value.Created));
+		TestEqual(FString::Printf(TEXT("Live %s after churn"), *Pair.Key.ToString()), Pair.Value.Live, BaselineLive);
+	}
+
+	TestTrue(TEXT("Enemies spawned"), Spawner->GetNumSpawned() > 0);
+	TestTrue(TEXT("Dead enemies dropped mask pickups"), NumDropped > 0);
+
+	return true;
+}
+
+#endif
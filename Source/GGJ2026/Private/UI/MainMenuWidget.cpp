@@ -5,11 +5,13 @@
 
 #include "Animation/WidgetAnimation.h"
 #include "Game/GGJGameInstance.h"
+#include "Game/GGJStats.h"
 #include "GameFramework/InputDeviceLibrary.h"
 #include "Kismet/GameplayStatics.h"
 
 void UMainMenuWidget::NativeConstruct()
 {
+	LLM_SCOPE_BYTAG(GGJ_UI);
 	Super::NativeConstruct();
 	
 	StartButton1P->OnClicked.AddDynamic(this, &UMainMenuWidget::StartGame1P);
@@ -3,10 +3,12 @@
 
 #include "UI/PauseMenuWidget.h"
 
+#include "Game/GGJStats.h"
 #include "Kismet/GameplayStatics.h"
 
 void UPauseMenuWidget::NativeConstruct()
 {
+	LLM_SCOPE_BYTAG(GGJ_UI);
 	Super::NativeConstruct();
 	
 	ContinueButton->OnClicked.AddDynamic(this, &UPauseMenuWidget::ResumeGame);
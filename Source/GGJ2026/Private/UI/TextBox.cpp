@@ -2,11 +2,13 @@
 
 
 #include "UI/TextBox.h"
+#include "Game/GGJStats.h"
 #include "Kismet/KismetStringLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 
 void UTextBoxWidget::NativeConstruct()
 {
+	LLM_SCOPE_BYTAG(GGJ_UI);
 	Super::NativeConstruct();
 }
 
@@ -27,6 +29,8 @@ void UTextBoxWidget::SkipDialogueText()
 
 void UTextBoxWidget::InitDialogueText(const FString& Text)
 {
+	LLM_SCOPE_BYTAG(GGJ_UI);
+	
 	CharArray = UKismetStringLibrary::GetCharacterArrayFromString(Text);
 	
 	CurrentIndex = 0;
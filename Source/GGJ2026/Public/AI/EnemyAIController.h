@@ -5,8 +5,11 @@
 #include "CoreMinimal.h"
 #include "AIController.h"
 #include "DetourCrowdAIController.h"
+#include "AI/EnemySteeringSubsystem.h"
 #include "EnemyAIController.generated.h"
 
+class UEnemyPathFollowingComponent;
+
 /**
  * 
  */
@@ -15,17 +18,61 @@ class GGJ2026_API AEnemyAIController : public ADetourCrowdAIController
 {
 	GENERATED_BODY()
 	
+public:
+	AEnemyAIController(const FObjectInitializer& ObjectInitializer);
+	
 protected:
 	virtual void BeginPlay() override;
 	
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	
 	virtual void OnPossess(APawn* InPawn) override;
 	
 public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
 	UBehaviorTree* AIBehaviorTree;
 	
+	/** Local avoidance used by this controller. Lets both backends run side by side in the same map. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI|Steering")
+	EEnemySteeringBackend SteeringBackend = EEnemySteeringBackend::DetourCrowd;
+	
 	void ActivateEnemyBT(bool IsEnemyReset);
 	
 	void DeactivateEnemyBT();
+	
+	/** Switches the steering backend at runtime. Only applied while the agent is idle. */
+	UFUNCTION(BlueprintCallable, Category = "AI|Steering")
+	void SetSteeringBackend(EEnemySteeringBackend NewBackend);
+	
+	UEnemyPathFollowingComponent* GetEnemyPathFollowing() const;
+
+	/**
+	 * Pathfinding moves without an out path (the Blueprint MoveTo proxy used by the behavior tree tasks) get their
+	 * path from UEnemyPathBroker instead of a synchronous query. They report FAIRequestID::AnyRequest as their id,
+	 * and completion comes through the path following component as usual once the path is in.
+	 */
+	virtual FPathFollowingRequestResult MoveTo(const FAIMoveRequest& MoveRequest, FNavPathSharedPtr* OutPath = nullptr) override;
+
+	virtual void StopMovement() override;
+
+	/** Moves to Goal using a path from the shared path broker instead of a synchronous query. */
+	UFUNCTION(BlueprintCallable, Category = "AI|Navigation")
+	void MoveToLocationBrokered(const FVector& Goal, float AcceptanceRadius = -1.0f);
+
+	/** Moves to the actor's current location using a path from the shared path broker. */
+	UFUNCTION(BlueprintCallable, Category = "AI|Navigation")
+	void MoveToActorBrokered(AActor* Goal, float AcceptanceRadius = -1.0f);
+
+private:
+	uint32 PendingPathRequestId = 0;
+
+	FAIMoveRequest PendingMoveRequest;
+
+	void RequestBrokeredMove(const FAIMoveRequest& MoveRequest);
+
+	/** Drops the pending broker request and tells whoever waits on it that the move finished with Flags. */
+	void CancelBrokeredMove(FPathFollowingResultFlags::Type Flags);
+
+	void OnBrokeredPathReady(uint32 RequestId, bool bSuccess, FNavPathSharedPtr Path);
 
 };
@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Items/MaskPickup.h"
+#include "EnemyArchetype.generated.h"
+
+class UPaperFlipbook;
+
+/** Archetype values read during gameplay, stored contiguously by the registry for batched systems. */
+struct FEnemyArchetypeData
+{
+	float Damage = 10.0f;
+	float KnockBackStrength = 3000.0f;
+	int32 ScorePoints = 10;
+	EEnemyType Type = EEnemyType::None;
+};
+
+/**
+ * Everything that is the same for all enemies of one type. Enemies only keep an index into
+ * UEnemyArchetypeRegistry, so spawning an enemy of another type is a single integer write.
+ * Assets live in /Game/Data/Enemies and are found through the asset manager.
+ */
+UCLASS(BlueprintType)
+class GGJ2026_API UEnemyArchetype : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	static const FPrimaryAssetType PrimaryAssetType;
+
+	/** Also the mask dropped on death, None drops nothing. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetype")
+	EEnemyType Type = EEnemyType::None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat")
+	float Damage = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat")
+	float KnockBackStrength = 3000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GGJ|Flow")
+	int32 ScorePoints = 10;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GGJ|Masks")
+	TSubclassOf<AMaskPickup> PickupClass;
+
+	/** Flipbook of the dropped mask. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GGJ|Masks|Visuals")
+	UPaperFlipbook* MaskFlipbook;
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	FEnemyArchetypeData MakeData() const;
+};
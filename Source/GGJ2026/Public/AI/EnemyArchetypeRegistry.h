@@ -0,0 +1,59 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AI/EnemyArchetype.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "EnemyArchetypeRegistry.generated.h"
+
+class AEnemyCharacter;
+
+/**
+ * Loads every enemy archetype once per game instance and hands them out by index.
+ * Index order is stable: archetypes are sorted by type, then by asset name. Every enemy type has at
+ * least one entry; types without an asset get a transient one. Enemies of those types resolve to
+ * transient archetypes built from the legacy values they still carry, appended after the sorted ones.
+ */
+UCLASS()
+class GGJ2026_API UEnemyArchetypeRegistry : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY()
+	TArray<UEnemyArchetype*> Archetypes;
+
+	/** Same order as Archetypes. */
+	TArray<FEnemyArchetypeData> ArchetypeData;
+
+	void AddArchetype(UEnemyArchetype* Archetype);
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	static UEnemyArchetypeRegistry* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Index unchanged if the archetype at Index comes from an asset. Otherwise the transient archetype of the same type
+	 * holding Enemy's legacy values, added if no other enemy had those values yet.
+	 */
+	int32 ResolveLegacyArchetype(const AEnemyCharacter* Enemy, int32 Index);
+
+	/** First archetype of Type, or INDEX_NONE. */
+	int32 FindArchetypeIndex(EEnemyType Type) const;
+
+	bool IsValidIndex(int32 Index) const { return ArchetypeData.IsValidIndex(Index); }
+
+	const UEnemyArchetype* GetArchetype(int32 Index) const { return Archetypes.IsValidIndex(Index) ? Archetypes[Index] : nullptr; }
+
+	const FEnemyArchetypeData& GetData(int32 Index) const;
+
+	/** All archetype data, indexable by archetype index. */
+	TConstArrayView<FEnemyArchetypeData> GetAllData() const { return ArchetypeData; }
+
+	/** Data for WorldContextObject's registry, or defaults when there is none (e.g. editor previews). */
+	static const FEnemyArchetypeData& GetData(const UObject* WorldContextObject, int32 Index);
+};
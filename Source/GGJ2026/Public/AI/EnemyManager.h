@@ -27,6 +27,10 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void SetMaxToken(int32 NewMax);
 	
+	int32 GetMaxTokens() const { return MaxTokens; }
+	
+	int32 GetNumTokenHolders() const { return ActiveTokenHolders.Num(); }
+	
 	// Attack Token Handling
 	UFUNCTION(BlueprintCallable)
 	bool HasToken(AActor* EnemyActor) const;
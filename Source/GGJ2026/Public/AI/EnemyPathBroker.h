@@ -0,0 +1,134 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyPathBroker.generated.h"
+
+class AEnemyAIController;
+
+/** Called on the game thread when a brokered path query completes. */
+DECLARE_DELEGATE_ThreeParams(FOnEnemyPathReady, uint32 /*RequestId*/, bool /*bSuccess*/, FNavPathSharedPtr /*Path*/);
+
+/** Snapshot of the broker's queue for debugging and profiling. */
+USTRUCT(BlueprintType)
+struct GGJ2026_API FEnemyPathBrokerStats
+{
+	GENERATED_BODY()
+
+	/** Requests waiting to be dispatched. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 QueueDepth = 0;
+
+	/** Queries dispatched to the navigation system and not yet answered. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 InFlight = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 TotalRequests = 0;
+
+	/** Requests that piggybacked on another request's query. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 DedupedRequests = 0;
+
+	/** Queries dispatched during the last tick. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 DispatchedLastFrame = 0;
+
+	/** Smoothed time from request to callback, in milliseconds. */
+	UPROPERTY(BlueprintReadOnly)
+	float AverageLatencyMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly)
+	float MaxLatencyMs = 0.0f;
+};
+
+/**
+ * Collects path requests from enemy controllers and runs them through FindPathAsync
+ * under a per-frame budget. Requests sharing a start cell and goal cell are merged into a
+ * single query. Token holders are served first, then the requests closest to their goal.
+ */
+UCLASS()
+class GGJ2026_API UEnemyPathBroker : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	struct FRequest
+	{
+		uint32 RequestId = 0;
+		TWeakObjectPtr<AEnemyAIController> Requester;
+		FVector Start = FVector::ZeroVector;
+		FOnEnemyPathReady Callback;
+		double QueuedTime = 0.0;
+	};
+
+	/** All requests that resolve to the same query. */
+	struct FBatch
+	{
+		FVector Start = FVector::ZeroVector;
+		FVector Goal = FVector::ZeroVector;
+		TArray<FRequest> Requests;
+		uint32 QueryId = 0;
+		float Priority = 0.0f;
+	};
+
+	/** Edge length used to quantize start and goal locations for deduplication. */
+	UPROPERTY(EditAnywhere, Category = "Pathfinding")
+	float DedupCellSize = 100.0f;
+
+	/** Max queries handed to the navigation system per frame. */
+	UPROPERTY(EditAnywhere, Category = "Pathfinding")
+	int32 MaxDispatchPerFrame = 8;
+
+	/** Max queries waiting for an answer at any time. */
+	UPROPERTY(EditAnywhere, Category = "Pathfinding")
+	int32 MaxInFlight = 16;
+
+	/** Game thread time the broker may spend dispatching per frame. */
+	UPROPERTY(EditAnywhere, Category = "Pathfinding")
+	float DispatchBudgetMs = 0.5f;
+
+	TMap<uint64, FBatch> PendingBatches;
+	TMap<uint64, FBatch> InFlightBatches;
+	TMap<uint32, uint64> QueryToBatch;
+
+	uint32 NextRequestId = 1;
+
+	FEnemyPathBrokerStats Stats;
+
+	uint64 MakeBatchKey(const FVector& Start, const FVector& Goal) const;
+
+	float ComputePriority(const FBatch& Batch) const;
+
+	bool DispatchBatch(uint64 Key, FBatch& Batch);
+
+	void OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+
+	/** Copies a shared result so every requester follows its own path instance, starting from its own location. */
+	static FNavPathSharedPtr ClonePathForRequest(const FNavPathSharedPtr& Path, const FVector& Start);
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	/** Queues a path query. Returns the request id, or 0 if the request was rejected. */
+	uint32 RequestPath(AEnemyAIController* Requester, const FVector& Start, const FVector& Goal, FOnEnemyPathReady Callback);
+
+	/** Drops every pending request from this controller. In-flight results will not be delivered to it. */
+	void CancelRequests(AEnemyAIController* Requester);
+
+	UFUNCTION(BlueprintCallable)
+	FEnemyPathBrokerStats GetStats() const;
+
+	UFUNCTION(BlueprintCallable)
+	void SetMaxDispatchPerFrame(int32 NewMax);
+
+	UFUNCTION(BlueprintCallable)
+	void SetDispatchBudgetMs(float NewBudget);
+};
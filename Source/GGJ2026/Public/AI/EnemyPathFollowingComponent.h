@@ -0,0 +1,44 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Navigation/CrowdFollowingComponent.h"
+#include "EnemyPathFollowingComponent.generated.h"
+
+/**
+ * Crowd following component that can hand local avoidance over to UEnemySteeringSubsystem.
+ * With spatial hash steering enabled the DetourCrowd simulation is switched off and the
+ * velocity computed by the subsystem replaces the default path segment following.
+ */
+UCLASS()
+class GGJ2026_API UEnemyPathFollowingComponent : public UCrowdFollowingComponent
+{
+	GENERATED_BODY()
+
+protected:
+	bool bUseSpatialHashSteering = false;
+
+	/** Desired XY direction from the last steering pass. Length is in [0, 1]. */
+	FVector2D SteeringDirection = FVector2D::ZeroVector;
+
+	bool bHasSteering = false;
+
+	virtual void FollowPathSegment(float DeltaTime) override;
+
+	virtual void OnPathFinished(const FPathFollowingResult& Result) override;
+
+public:
+	/** Switches between DetourCrowd and spatial hash steering. Only valid while the agent is idle. */
+	void SetUseSpatialHashSteering(bool bEnable);
+
+	bool UsesSpatialHashSteering() const { return bUseSpatialHashSteering; }
+
+	/** Called by the steering subsystem with this frame's result. */
+	void SetSteeringDirection(const FVector2D& Direction);
+
+	/** Returns true and the current path target if the agent is following a path. */
+	bool GetSteeringGoal(FVector& OutGoal) const;
+
+	APawn* GetControlledPawn() const;
+};
@@ -7,6 +7,8 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "EnemySpawnerManager.generated.h"
 
+class UEnemyArchetypeRegistry;
+
 /**
  * 
  */
@@ -32,17 +34,37 @@ protected:
 		
 	TQueue<AEnemyCharacter*> EnemyPool;
 	
+	/** Everything put in EnemyPool, for stats. TQueue can't be iterated and its pointers go stale when a pooled enemy is destroyed. */
+	TArray<TWeakObjectPtr<AEnemyCharacter>> PooledEnemies;
+	
+	/** Enemies spawned since the subsystem started. */
+	int32 NumSpawned = 0;
+	
 	UPROPERTY()
 	TSet<AEnemyCharacter*> ActiveEnemies;
 	
 	UPROPERTY()
 	TArray<AActor*> EnemySpawners;
 	
+	/** Archetype indices in spawn order, mixed by type. */
 	UPROPERTY()
-	TArray<EEnemyType> EnemyTypeList;
+	TArray<int32> ArchetypeList;
 	
 	UPROPERTY()
 	int32 TypeIdx;
+	
+	/** Every random choice of the spawn flow, so a match can be replayed from its seed. */
+	FRandomStream Random;
+	
+	/** Spawners further than this outside the view are skipped, so enemies walk in quickly. */
+	UPROPERTY(EditAnywhere)
+	float MaxSpawnDistanceOutsideView = 1500.0f;
+	
+	/** Picks a spawner just outside the camera view, or any spawner if none qualifies. */
+	AActor* ChooseSpawner() const;
+	
+	/** Fills OutList with MaxEnemies archetype indices: 40% without mask, 20% of each mask type. */
+	void BuildArchetypeList(TArray<int32>& OutList) const;
 		
 	
 public:
@@ -60,6 +82,33 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void SetEnemyClass(UClass* NewClass);
 	
+	int32 GetMaxEnemies() const { return MaxEnemies; }
+	
+	int32 GetNumActiveEnemies() const { return ActiveEnemies.Num(); }
+	
+	int32 GetNumSpawned() const { return NumSpawned; }
+	
+	/** Pooled enemies that still exist and are not active. */
+	int32 GetNumPooled() const;
+	
+	/** False while nothing was ever pooled. SpawnEnemy spawns fresh enemies, so the pool is normally unused. */
+	bool HasPool() const { return PooledEnemies.Num() > 0; }
+	
+	bool IsActiveEnemy(const AEnemyCharacter* Enemy) const { return ActiveEnemies.Contains(const_cast<AEnemyCharacter*>(Enemy)); }
+	
+	/** Seconds until the spawn timer fires next, or -1 while it is not running. */
+	float GetTimeUntilNextSpawn() const;
+	
+	/** Reseeds the spawn flow. Spawners that begin play afterwards derive their seeds from it. */
+	void SetRandomSeed(int32 Seed);
+	
+	int32 GetRandomSeed() const { return Random.GetInitialSeed(); }
+	
+	/** Seed for one AEnemySpawner, stable across runs as long as the level keeps its actor names. */
+	int32 GetSpawnerSeed(const AActor* Spawner) const;
+	
+	bool HasEnemyClass() const { return EnemyClass != nullptr; }
+	
 	void AddEnemyToPool(AEnemyCharacter* Enemy);
 	
 	UFUNCTION(BlueprintCallable)
@@ -73,6 +122,21 @@ public:
 	
 	void SpawnEnemy();
 	
+	/** Appends Count archetype indices from Registry in the spawn distribution. A null registry yields index 0. */
+	static void BuildArchetypeList(int32 Count, const UEnemyArchetypeRegistry* Registry, TArray<int32>& OutList);
+	
+	/** Fisher-Yates shuffle, the order enemies leave the pool in. */
+	template <typename T>
+	static void ShuffleList(TArray<T>& Items, const FRandomStream& Stream)
+	{
+		const int32 LastIndex = Items.Num() - 1;
+		for (int32 i = 0; i < LastIndex; ++i)
+		{
+			const int32 Index = Stream.RandRange(i, LastIndex);
+			if (i != Index) Items.Swap(i, Index);
+		}
+	}
+	
 	UFUNCTION(BlueprintCallable)
 	void ResetEnemy(AEnemyCharacter* Enemy);
 };
@@ -0,0 +1,88 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemySteeringSubsystem.generated.h"
+
+class UEnemyPathFollowingComponent;
+
+/** Local avoidance backend used by an enemy controller. */
+UENUM(BlueprintType)
+enum class EEnemySteeringBackend : uint8
+{
+	DetourCrowd	UMETA(DisplayName = "Detour Crowd"),
+	SpatialHash	UMETA(DisplayName = "Spatial Hash")
+};
+
+/**
+ * Cheap local avoidance for enemies that opted out of DetourCrowd.
+ * Once per frame it buckets every registered agent into a uniform XY grid and computes
+ * separation, cohesion and goal-seeking in a single parallel pass. The result is stored
+ * on each agent's path following component and consumed on its next path update.
+ */
+UCLASS()
+class GGJ2026_API UEnemySteeringSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	/** Edge length of one grid cell. Keep it >= the largest query radius so the 3x3 block around a cell is enough. */
+	UPROPERTY(EditAnywhere, Category = "Steering")
+	float CellSize = 400.0f;
+
+	/** Agents closer than this push each other apart. */
+	UPROPERTY(EditAnywhere, Category = "Steering")
+	float SeparationRadius = 120.0f;
+
+	/** Agents closer than this pull slightly towards their local centroid. */
+	UPROPERTY(EditAnywhere, Category = "Steering")
+	float CohesionRadius = 400.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Steering")
+	float GoalWeight = 1.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Steering")
+	float SeparationWeight = 1.5f;
+
+	UPROPERTY(EditAnywhere, Category = "Steering")
+	float CohesionWeight = 0.1f;
+
+	UPROPERTY()
+	TArray<UEnemyPathFollowingComponent*> Agents;
+
+	// Per-frame packed scratch data, indexed like ActiveAgents
+	TArray<UEnemyPathFollowingComponent*> ActiveAgents;
+	TArray<FVector2D> Positions;
+	TArray<FVector2D> Goals;
+	TArray<bool> HasGoal;
+	TArray<FVector2D> Results;
+
+	/** Agent indices sorted by cell, and the [Start, Count] range of each occupied cell. */
+	TArray<int32> SortedIndices;
+	TMap<FIntPoint, FIntPoint> CellRanges;
+
+	FIntPoint GetCell(const FVector2D& Position) const;
+
+	FVector2D ComputeSteering(int32 AgentIndex) const;
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	void RegisterAgent(UEnemyPathFollowingComponent* Agent);
+
+	void UnregisterAgent(UEnemyPathFollowingComponent* Agent);
+
+	UFUNCTION(BlueprintCallable)
+	void SetSeparationRadius(float NewRadius);
+
+	UFUNCTION(BlueprintCallable)
+	void SetCohesionRadius(float NewRadius);
+
+	int32 GetNumAgents() const { return Agents.Num(); }
+};
@@ -0,0 +1,104 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Notifies/PaperZDAnimNotify.h"
+#include "CombatAnimNotifies.generated.h"
+
+/** Combat events raised by the native notifies below, queued for enemies and applied by the frame pipeline. */
+UENUM(BlueprintType)
+enum class ECombatNotifyType : uint8
+{
+	ActivateHitbox,
+	DeactivateHitbox,
+	AttackFinished,
+	Death
+};
+
+/**
+ * Activates the melee hitbox at the start of the active frames.
+ * Works on both players and enemies; replaces AN_ActivateHitbox and AN_ActivateHitboxEnemy.
+ */
+UCLASS(meta = (DisplayName = "Activate Hitbox"))
+class GGJ2026_API UGGJAnimNotify_ActivateHitbox : public UPaperZDAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	/** Socket in the current flipbook the hitbox snaps to. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat")
+	FName SocketName = TEXT("Hitbox");
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat")
+	FVector Extent = FVector(30.f, 30.f, 30.f);
+
+	/** Entry of the player's ComboDamageValues used for this swing. -1 uses the current combo index. Ignored by enemies. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat")
+	int32 DamageIndex = -1;
+
+	virtual void OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance = nullptr) const override;
+};
+
+/** Disables the melee hitbox at the end of the active frames. Replaces AN_DeactivateHitbox. */
+UCLASS(meta = (DisplayName = "Deactivate Hitbox"))
+class GGJ2026_API UGGJAnimNotify_DeactivateHitbox : public UPaperZDAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance = nullptr) const override;
+};
+
+/** End of an attack animation. Replaces AN_AttackFinished and AN_AttackFinishedEnemy. */
+UCLASS(meta = (DisplayName = "Attack Finished"))
+class GGJ2026_API UGGJAnimNotify_AttackFinished : public UPaperZDAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance = nullptr) const override;
+};
+
+/** End of the player's roll animation. Replaces AN_RollFinished. */
+UCLASS(meta = (DisplayName = "Roll Finished"))
+class GGJ2026_API UGGJAnimNotify_RollFinished : public UPaperZDAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance = nullptr) const override;
+};
+
+/** End of the player's get up animation. Replaces AN_GetUpFinished. */
+UCLASS(meta = (DisplayName = "Get Up Finished"))
+class GGJ2026_API UGGJAnimNotify_GetUpFinished : public UPaperZDAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance = nullptr) const override;
+};
+
+/** End of an enemy's death animation, drops its mask and returns the enemy to the spawner. Replaces AN_OnDeathenemy. */
+UCLASS(meta = (DisplayName = "Enemy Death"))
+class GGJ2026_API UGGJAnimNotify_EnemyDeath : public UPaperZDAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance = nullptr) const override;
+};
+
+/** Moves the player's mask sprite to a socket of the current flipbook. Replaces AN_UpdateMaskSocket. */
+UCLASS(meta = (DisplayName = "Update Mask Socket"))
+class GGJ2026_API UGGJAnimNotify_UpdateMaskSocket : public UPaperZDAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mask")
+	FName SocketName = TEXT("Mask");
+
+	virtual void OnReceiveNotify_Implementation(UPaperZDAnimInstance* OwningInstance = nullptr) const override;
+};
@@ -0,0 +1,112 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyAnimBudgetSubsystem.generated.h"
+
+class AEnemyCharacter;
+
+/** Per-frame counters for the enemy animation budget. */
+USTRUCT(BlueprintType)
+struct GGJ2026_API FEnemyAnimBudgetStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 Registered = 0;
+
+	/** Anim instances evaluated this frame, forced and budgeted. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 Evaluated = 0;
+
+	/** Enemies that showed their group leader's evaluated frame instead of evaluating their own. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 Shared = 0;
+
+	/** Off-screen enemies with their flipbook frozen. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 Frozen = 0;
+};
+
+/**
+ * Takes over ticking of enemy PaperZD anim instances.
+ * Only MaxEvaluationsPerFrame instances are evaluated each frame. The rest accumulate their delta time
+ * and catch up in one step on their next turn, so no notify is skipped. Enemies in the same animation
+ * state (archetype, hit/attack/death state, facing sector, moving or not) form a group: one leader per group is evaluated first,
+ * and members left over the budget copy the leader's flipbook and playback position until their own turn.
+ * Attacking and dying enemies always evaluate at full rate, so hitbox and death notifies fire on time.
+ * Off-screen enemies freeze their flipbook and stop accumulating time altogether, unless attacking or dying.
+ * Without a camera view (-nullrhi, servers) every enemy counts as on screen, so headless runs pay the full cost.
+ */
+UCLASS()
+class GGJ2026_API UEnemyAnimBudgetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	struct FAgentState
+	{
+		float AccumulatedTime = 0.0f;
+		bool bFrozen = false;
+	};
+
+	/** Budgeted evaluations per frame, on top of the forced ones. */
+	UPROPERTY(EditAnywhere, Category = "Animation")
+	int32 MaxEvaluationsPerFrame = 16;
+
+	/** An instance that has waited this long is evaluated regardless of the budget. */
+	UPROPERTY(EditAnywhere, Category = "Animation")
+	float MaxAccumulatedTime = 0.2f;
+
+	/** Radius around an enemy that must leave the view before its flipbook freezes. */
+	UPROPERTY(EditAnywhere, Category = "Animation")
+	float OffScreenMargin = 150.0f;
+
+	UPROPERTY()
+	TArray<AEnemyCharacter*> Enemies;
+
+	/** Indexed like Enemies. */
+	TArray<FAgentState> States;
+
+	// Per-frame scratch
+	TArray<int32> Candidates;
+	TMap<uint32, int32> GroupLeaders;
+
+	FEnemyAnimBudgetStats Stats;
+
+	bool IsOnScreen(const AEnemyCharacter* Enemy) const;
+
+	/** Packs the inputs ABP_Enemy picks its state and direction from. Equal keys play the same flipbook. */
+	static uint32 GetAnimStateKey(const AEnemyCharacter* Enemy);
+
+	/** Shows the leader's current frame on the follower without evaluating the follower's anim instance. */
+	void CopyLeaderFrame(int32 LeaderIndex, int32 FollowerIndex) const;
+
+	void SetFrozen(int32 Index, bool bFreeze);
+
+	void Evaluate(int32 Index);
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	void RegisterEnemy(AEnemyCharacter* Enemy);
+
+	void UnregisterEnemy(AEnemyCharacter* Enemy);
+
+	UFUNCTION(BlueprintCallable)
+	void SetMaxEvaluationsPerFrame(int32 NewMax);
+
+	UFUNCTION(BlueprintCallable)
+	FEnemyAnimBudgetStats GetStats() const { return Stats; }
+	
+	bool IsRegistered(const AEnemyCharacter* Enemy) const { return Enemies.Contains(Enemy); }
+	
+	/** True while Enemy is off-screen with its flipbook frozen. */
+	bool IsFrozen(const AEnemyCharacter* Enemy) const;
+};
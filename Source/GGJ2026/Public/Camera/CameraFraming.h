@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Pure math used by the shared camera: framing a group of points and intersecting the view
+ * frustum with horizontal planes. No world or viewport access, so it is cheap and easy to reuse.
+ */
+struct GGJ2026_API FCameraFraming
+{
+	/** The four rays through the (padded) screen corners, computed once per frame. */
+	struct FViewRays
+	{
+		FVector Origin = FVector::ZeroVector;
+
+		/** Top-left, top-right, bottom-right, bottom-left. Not normalized. */
+		FVector Directions[4];
+
+		bool bValid = false;
+	};
+
+	/**
+	 * Average of the points and the largest distance between any two of them, as the camera was tuned with.
+	 * Pairwise, but only over the handful of players, with no square root inside the loop.
+	 * @return false if there are no points.
+	 */
+	static bool ComputeFraming(TArrayView<const FVector> Points, FVector& OutCenter, float& OutSpread);
+
+	/**
+	 * Rays through the screen corners, moved inwards by EdgePadding pixels.
+	 * @param HorizontalFOV Full horizontal field of view in degrees.
+	 * @param ViewportSize Viewport size in pixels, used for the aspect ratio and the padding.
+	 */
+	static FViewRays ComputeViewRays(const FVector& ViewLocation, const FRotator& ViewRotation, float HorizontalFOV, const FVector2D& ViewportSize, float EdgePadding);
+
+	/**
+	 * Intersects the rays with the plane at PlaneZ.
+	 * @return false if any ray points away from the plane, i.e. the horizon is on screen.
+	 */
+	static bool GetPlaneQuad(const FViewRays& Rays, float PlaneZ, FVector2D OutQuad[4]);
+
+	static bool IsInsideQuad(const FVector2D& Point, const FVector2D Quad[4]);
+
+	/** Closest point of the quad to Point. Returns Point unchanged if it is inside. */
+	static FVector2D ClampToQuad(const FVector2D& Point, const FVector2D Quad[4]);
+};
@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ConvexVolume.h"
+#include "Camera/CameraFraming.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CameraVisibilitySubsystem.generated.h"
+
+/**
+ * Answers "is this visible" once per frame for everyone. The view frustum and the visible quad on the
+ * ground are computed from player 0's camera at the start of the tick; queries are then plain math over
+ * caller-provided positions. Masks, spawners and the enemy anim budget all read from here.
+ */
+UCLASS()
+class GGJ2026_API UCameraVisibilitySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	FConvexVolume ViewFrustum;
+
+	FCameraFraming::FViewRays ViewRays;
+
+	/** Visible area on the plane at GroundZ. */
+	FVector2D GroundQuad[4];
+
+	float GroundZ = 0.0f;
+
+	bool bHasView = false;
+
+	bool bHasGroundQuad = false;
+
+public:
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	/** False until a player camera has rendered, in which case every query reports "visible". */
+	bool HasView() const { return bHasView; }
+
+	/** True if a sphere at Location overlaps the view frustum. */
+	bool IsOnScreen(const FVector& Location, float Radius = 0.0f) const;
+
+	/** XY distance from Location to the visible ground area, 0 when inside it. */
+	float DistanceOutsideView(const FVector& Location) const;
+
+	/** Bulk IsOnScreen. OutOnScreen must be as long as Locations. */
+	void AreOnScreen(TArrayView<const FVector> Locations, float Radius, TArrayView<bool> OutOnScreen) const;
+
+	/** Bulk DistanceOutsideView. OutDistances must be as long as Locations. */
+	void GetDistancesOutsideView(TArrayView<const FVector> Locations, TArrayView<float> OutDistances) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Camera")
+	bool IsLocationOnScreen(FVector Location, float Radius = 0.0f) const { return IsOnScreen(Location, Radius); }
+};
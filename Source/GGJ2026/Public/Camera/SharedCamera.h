@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Camera/CameraFraming.h"
 #include "SharedCamera.generated.h"
 
 UCLASS()
@@ -14,6 +15,14 @@ class GGJ2026_API ASharedCamera : public AActor
 public:	
 	ASharedCamera();
 
+	/** Adds a pawn to the framed players. Called when a player controller possesses it. */
+	void RegisterPlayer(APawn* Player);
+
+	void UnregisterPlayer(APawn* Player);
+
+	/** Rays through the padded screen corners, as of this frame's clamp. */
+	const FCameraFraming::FViewRays& GetViewRays() const { return ViewRays; }
+
 protected:
 	virtual void Tick(float DeltaTime) override;
 	virtual void BeginPlay() override;
@@ -50,11 +59,25 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Settings")
 	float ScreenEdgePadding;
 
+	/** Framed players, kept up to date by possess / unpossess instead of being gathered every frame. */
+	TArray<TWeakObjectPtr<APawn>> Players;
+
+	/** Player locations for the current frame, indexed like Players. */
+	TArray<FVector> PlayerLocations;
+
+	FCameraFraming::FViewRays ViewRays;
+
+	void GatherPlayerLocations();
+
 	void UpdateCameraPosition(float DeltaTime);
 
-	/** Constrains player positions to the visible viewport bounds. */
+	/**
+	 * Constrains player positions to the visible viewport bounds.
+	 * Players using UGGJCharacterMovementComponent receive the bounds and stay inside on their own;
+	 * any other pawn is moved back with a swept SetActorLocation.
+	 */
 	void ClampPlayersToScreen();
 
-	/** Helper to get all active player pawns efficiently without iterating the whole world. */
-	void GetActivePlayerPawns(TArray<AActor*>& OutPlayers) const;
+	/** Registers the pawns that were possessed before this camera began play. */
+	void RegisterExistingPlayers();
 };
\ No newline at end of file
@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "EnemyMovementComponent.generated.h"
+
+/**
+ * Movement for enemies that only walk on the flat arena. Instead of CharacterMovement's floor sweeps, step-up
+ * and slope handling, the pawn is snapped to a floor height probed now and then, and moves on XY with one sweep
+ * and a slide along whatever it hits.
+ */
+UCLASS(ClassGroup = Movement, meta = (BlueprintSpawnableComponent))
+class GGJ2026_API UEnemyMovementComponent : public UPawnMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	UEnemyMovementComponent();
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy Movement")
+	float MaxSpeed = 500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy Movement")
+	float Acceleration = 2048.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy Movement")
+	float Deceleration = 2048.0f;
+
+	/** Exponential damping applied to knockback velocity, per second. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy Movement")
+	float KnockbackDamping = 8.0f;
+
+	/** The floor is probed again after moving this far on XY... */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy Movement|Floor")
+	float FloorProbeDistance = 200.0f;
+
+	/** ...or after this long. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy Movement|Floor")
+	float FloorProbeInterval = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy Movement|Floor")
+	float FloorProbeDepth = 500.0f;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	virtual float GetMaxSpeed() const override { return MaxSpeed; }
+
+	virtual bool IsMovingOnGround() const override { return bHasFloor; }
+
+	virtual bool CanStartPathFollowing() const override { return IsActive(); }
+
+	virtual void RequestDirectMove(const FVector& MoveVelocity, bool bForceMaxSpeed) override;
+
+	virtual void StopActiveMovement() override;
+
+	virtual void StopMovementImmediately() override;
+
+	/**
+	 * Replaces the XY velocity on the next tick, like LaunchCharacter(Impulse, true, true) on CharacterMovement.
+	 * Hits in the same frame add up, so several of them all push.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Enemy Movement")
+	void AddKnockback(const FVector& Impulse);
+
+	/** Forces a floor probe on the next tick, e.g. after a teleport. */
+	void InvalidateFloor() { bHasFloor = false; }
+
+protected:
+	/** Set by path following or the crowd, consumed every tick. */
+	FVector RequestedVelocity = FVector::ZeroVector;
+
+	bool bHasRequestedVelocity = false;
+
+	/** Velocity from walking alone, Velocity also includes knockback. */
+	FVector WalkVelocity = FVector::ZeroVector;
+
+	FVector KnockbackVelocity = FVector::ZeroVector;
+
+	/** Knockback added since the last tick. */
+	FVector PendingKnockback = FVector::ZeroVector;
+
+	bool bHasPendingKnockback = false;
+
+	float FloorZ = 0.0f;
+
+	FVector2D LastFloorProbeLocation = FVector2D::ZeroVector;
+
+	float TimeSinceFloorProbe = 0.0f;
+
+	bool bHasFloor = false;
+
+	void UpdateFloor(float DeltaTime);
+};
@@ -0,0 +1,116 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GGJCharacterMovementComponent.generated.h"
+
+/** Values of CustomMovementMode while in MOVE_Custom. */
+UENUM(BlueprintType)
+enum class EGGJCustomMovementMode : uint8
+{
+	None		UMETA(DisplayName = "None"),
+	Lunge		UMETA(DisplayName = "Lunge"),
+	Roll		UMETA(DisplayName = "Roll"),
+	Knockdown	UMETA(DisplayName = "Knockdown")
+};
+
+/**
+ * Character movement for players. Keeps the pawn inside the shared camera's view by clipping
+ * its velocity against vertical boundary planes before the move, so no corrective teleport is needed.
+ *
+ * Lunge, roll and knockdown are custom movement modes. Each follows a closed-form trajectory from the
+ * state captured when it started, so the position at any time can be predicted and a replay of the same
+ * start reproduces the same path. Every step is a single sweep along that trajectory.
+ */
+UCLASS()
+class GGJ2026_API UGGJCharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+protected:
+	/** Vertical planes around the visible area, normals pointing inwards. Refreshed by the camera every frame. */
+	TArray<FPlane, TInlineAllocator<4>> CameraBoundaryPlanes;
+
+	/** Max speed used to walk back inside when the camera has moved past the pawn. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Bounds")
+	float BoundsRecoverySpeed = 600.0f;
+
+	FVector ClipToCameraBounds(const FVector& InVelocity, float DeltaTime) const;
+
+	/** Time constant of the lunge's approach to its target. */
+	float LungeTimeConstant = 0.15f;
+
+	/**
+	 * Exponential damping of the roll speed on the ground, per second. The roll used to slide with
+	 * GroundFriction 2 and no braking, which CharacterMovement damps at GroundFriction * BrakingFrictionFactor.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Custom Movement")
+	float RollDamping = 4.0f;
+
+	/** Rolls end on their own below this speed if the animation has not ended them. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Custom Movement")
+	float RollMinSpeed = 50.0f;
+
+	/** Safety net for lunges and knockdowns that never reach their end condition. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Custom Movement")
+	float MaxCustomMovementTime = 3.0f;
+
+	/** Trajectory state, rebased when a sweep is blocked. */
+	FVector CustomStartLocation = FVector::ZeroVector;
+	FVector CustomStartVelocity = FVector::ZeroVector;
+	FVector LungeTarget = FVector::ZeroVector;
+	float CustomElapsedTime = 0.0f;
+
+	/** The trajectory is ballistic: always for knockdowns, for rolls until they land or after they leave the floor. */
+	bool bCustomAirborne = false;
+
+	void StartCustomMovement(EGGJCustomMovementMode Mode, const FVector& StartVelocity);
+
+	void RebaseTrajectory(const FVector& NewStartVelocity);
+
+	virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Bounds")
+	bool bConstrainToCameraBounds = true;
+
+	virtual void CalcVelocity(float DeltaTime, float Friction, bool bFluid, float BrakingDeceleration) override;
+
+	virtual FVector NewFallVelocity(const FVector& InitialVelocity, const FVector& Gravity, float DeltaTime) const override;
+
+	/** Moves towards Target, covering most of the distance in one time constant. */
+	void StartLunge(const FVector& Target, float TimeConstant);
+
+	/**
+	 * Starts like LaunchCharacter(RollVelocity, true, true) did: airborne with no vertical speed, so gravity
+	 * applies and the speed is kept until the landing. On the ground the speed is damped by RollDamping.
+	 */
+	void StartRoll(const FVector& RollVelocity);
+
+	/** Ballistic launch ending in a landing. The character's Landed fires as with a regular fall. */
+	void StartKnockdown(const FVector& LaunchVelocity);
+
+	/** Ends the current custom mode and returns to walking, keeping the current velocity. */
+	void StopCustomMovement(EGGJCustomMovementMode Mode);
+
+	UFUNCTION(BlueprintPure, Category = "Custom Movement")
+	EGGJCustomMovementMode GetCustomMovementMode() const;
+
+	bool IsInCustomMovementMode(EGGJCustomMovementMode Mode) const { return GetCustomMovementMode() == Mode; }
+
+	/** Falling, or in a custom mode that is currently ballistic. IsFalling() alone misses knockdowns and airborne rolls. */
+	UFUNCTION(BlueprintPure, Category = "Custom Movement")
+	bool IsAirborne() const { return IsFalling() || (MovementMode == MOVE_Custom && bCustomAirborne); }
+
+	/** Where the current trajectory puts the pawn Time seconds after it started or was last rebased. */
+	FVector GetTrajectoryLocation(float Time) const;
+
+	FVector GetTrajectoryVelocity(float Time) const;
+
+	/** Sets the visible area as a convex quad on the XY plane, in any winding order. */
+	void SetCameraBounds(const FVector2D Quad[4]);
+
+	void ClearCameraBounds();
+};
@@ -9,26 +9,42 @@
 #include "Components/BoxComponent.h"
 #include "Components/HealthComponent.h"
 #include "Items/MaskPickup.h"
+#include "Characters/HitboxSweep.h"
 #include "EnemyCharacter.generated.h"
 
 class UBoxComponent;
+class UEnemyArchetype;
+class UEnemyMovementComponent;
+struct FEnemyArchetypeData;
 
 UCLASS(Abstract)
 class GGJ2026_API AEnemyCharacter : public APaperZDCharacter
 {
 	GENERATED_BODY()
 
+	friend class UGameplayFramePipeline;
+	friend class FGameplayDebuggerCategory_GGJ;
+
 public:
 	// Sets default values for this character's properties
 	AEnemyCharacter(const FObjectInitializer& ObjectInitializer);
 
 protected:	
-	UPROPERTY(EditAnywhere)
-	float Damage;
+	/** Index into UEnemyArchetypeRegistry. Type-specific values live in the archetype, not in every instance. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Archetype")
+	int32 ArchetypeIndex = 0;
 	
 	/** Tracks if the current attack has hit the player. Resets on new attack. */
 	bool bHasHitPlayer = false;
 	
+	/** Swept path of the hitbox during active frames, also remembers who this swing already hit. */
+	FHitboxSweep HitboxSweep;
+	
+	/** Sweeps the active hitbox and resolves its hits in order. */
+	void SweepMeleeHitbox();
+	
+	void ResolveHitboxHit(const FHitResult& Hit);
+	
 	// UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	// UBoxComponent* Box;
 		
@@ -41,8 +57,26 @@ protected:
 	UPROPERTY()
 	AEnemyAIController* AIController;
 	
+	/** True while UGameplayFramePipeline handles facing and hit resolution instead of Tick. */
+	bool bDrivenByFramePipeline = false;
+	
+	/** Flat-arena movement used instead of CharacterMovement when lightweight movement is on. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement")
+	UEnemyMovementComponent* LightweightMovement;
+	
+	/** Use LightweightMovement for this enemy. Can also be forced for every enemy with ggj.Enemy.LightweightMovement. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement")
+	bool bUseLightweightMovement = false;
+	
+	/** Decided once before possession so the AI caches the right movement component. */
+	bool bLightweightMovementActive = false;
+	
+	virtual void PostInitializeComponents() override;
+	
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
+	
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:	
 	/** Component that detects incoming damage (The Body) */
@@ -60,41 +94,67 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GGJ|Debug", meta = (DisplayPriority = "0"))
 	float AnimDirection = 180.0f;
 	
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	EEnemyType Type;
-	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	bool IsAttacking = false;
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	bool IsReset = false;
 	
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
-	float KnockBackStrenghth = 3000.0f;
-		
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	FVector SpawnLocation;
 	
+	// --- Legacy Per-Type Values ---
+	// Kept under their old names so enemy Blueprints and ABP_Enemy load unchanged. Gameplay reads the archetype;
+	// these only build archetypes for types that have no asset in /Game/Data/Enemies yet. Remove them, and the
+	// per-instance memory they cost, once every type has an asset.
+	
+	/** Mirrors GetEnemyType() for ABP_Enemy. Set on the Blueprint, it picks the archetype of enemies placed in a level. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EEnemyType Type;
+	
+	UPROPERTY(EditAnywhere, meta = (DeprecatedProperty, DeprecationMessage = "Set Damage on the enemy archetype asset."))
+	float Damage;
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat", meta = (DeprecatedProperty, DeprecationMessage = "Set KnockBackStrength on the enemy archetype asset."))
+	float KnockBackStrenghth = 3000.0f;
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (DeprecatedProperty, DeprecationMessage = "Set PickupClass on the enemy archetype asset."))
 	UClass* PickupClass;
 	
-	// --- Mask System (Visuals) ---
-
 	/** Flipbook asset for the Red Rabbit mask. */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GGJ|Masks|Visuals", meta = (DisplayPriority = "0"))
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GGJ|Masks|Visuals", meta = (DisplayPriority = "0", DeprecatedProperty, DeprecationMessage = "Set MaskFlipbook on the enemy archetype asset."))
 	class UPaperFlipbook* RedRabbitMaskFlipbook;
 
 	/** Flipbook asset for the Green Bird mask. */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GGJ|Masks|Visuals", meta = (DisplayPriority = "0"))
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GGJ|Masks|Visuals", meta = (DisplayPriority = "0", DeprecatedProperty, DeprecationMessage = "Set MaskFlipbook on the enemy archetype asset."))
 	class UPaperFlipbook* GreenBirdMaskFlipbook;
 
 	/** Flipbook asset for the Blue Cat mask. */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GGJ|Masks|Visuals", meta = (DisplayPriority = "0"))
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GGJ|Masks|Visuals", meta = (DisplayPriority = "0", DeprecatedProperty, DeprecationMessage = "Set MaskFlipbook on the enemy archetype asset."))
 	class UPaperFlipbook* BlueCatMaskFlipbook;
 	
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GGJ|Flow")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GGJ|Flow", meta = (DeprecatedProperty, DeprecationMessage = "Set ScorePoints on the enemy archetype asset."))
 	int32 ScorePoints = 10;
 	
+	/** Switches this enemy to another archetype, e.g. when it is taken from the pool. */
+	void SetArchetypeIndex(int32 NewIndex);
+	
+	int32 GetArchetypeIndex() const { return ArchetypeIndex; }
+	
+	const FEnemyArchetypeData& GetArchetypeData() const;
+	
+	UFUNCTION(BlueprintPure, Category = "Archetype")
+	const UEnemyArchetype* GetArchetype() const;
+	
+	UFUNCTION(BlueprintPure, Category = "Archetype")
+	EEnemyType GetEnemyType() const;
+	
+	/** True from the killing blow on, while the death animation plays out. */
+	bool IsDead() const { return HealthComp && HealthComp->IsActorDead(); }
+	
+	/** True while the hit reaction plays. */
+	bool IsHitReacting() const { return HealthComp && HealthComp->IsHit; }
+	
 	UFUNCTION(BlueprintImplementableEvent, Category = "Combat")
 	void OnEnemyDied();
 	
@@ -112,12 +172,17 @@ public:
 	
 	UFUNCTION(BlueprintCallable)
 	void DeactivateEnemy();
+	
+	/** End of the death animation: DeactivateEnemy, then ResetEnemy on the spawner, as AN_OnDeathenemy did. */
+	void FinishDeath();
 		
 	UFUNCTION()
 	void OnBoxBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
 	virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, class AController* EventInstigator, AActor* DamageCauser) override;
 	
+	virtual UPawnMovementComponent* GetMovementComponent() const override;
+	
 	UFUNCTION(BlueprintCallable)
 	bool CanAttack();
 	
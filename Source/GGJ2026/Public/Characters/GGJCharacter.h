@@ -6,6 +6,7 @@
 #include "PaperZDCharacter.h"
 #include "InputActionValue.h"
 #include "Items/MaskPickup.h"
+#include "Characters/HitboxSweep.h"
 #include "GGJCharacter.generated.h"
 
 class UInputMappingContext;
@@ -42,6 +43,9 @@ class GGJ2026_API AGGJCharacter : public APaperZDCharacter
 {
 	GENERATED_BODY()
 
+	friend class UGameplayFramePipeline;
+	friend class FGameplayDebuggerCategory_GGJ;
+
 public:
 	AGGJCharacter(const FObjectInitializer& ObjectInitializer);
 
@@ -173,6 +177,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GGJ|Combat|Lunge", meta = (DisplayPriority = "0"))
 	float LungeStopDistance = 60.0f;
 
+	/** Time constant of the lunge movement, most of the distance is covered in this time. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GGJ|Combat|Lunge", meta = (DisplayPriority = "0"))
+	float LungeDuration = 0.15f;
+
 	// --- Combat (Charge Attack) ---
 
 	/** Max time (seconds) to reach full charge damage */
@@ -311,13 +319,19 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaSeconds) override;
 	virtual void Landed(const FHitResult& Hit) override;
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 	virtual void PawnClientRestart() override;
+	virtual void PossessedBy(AController* NewController) override;
+	virtual void UnPossessed() override;
 	
 	void UpdateAnimationDirection();
 	void UpdateDirectionalArrow();
+
+	/** True while UGameplayFramePipeline handles facing and hit resolution instead of Tick. */
+	bool bDrivenByFramePipeline = false;
 	
 	// --- Damage & State Handlers ---
 
@@ -350,7 +364,6 @@ protected:
 	FTimerHandle HitCountResetTimerHandle;
 	FTimerHandle GroundedTimerHandle;
 	FTimerHandle InvincibilityOnGettingUpHandle;
-	float DefaultBrakingDeceleration;
 	float DefaultRollCooldown;
 	float DefaultMaxWalkSpeed;
 
@@ -382,14 +395,23 @@ protected:
 	/** Flag to prevent immediate throwing when picking up a mask in the same input press. */
 	bool bInputConsumed = false;
 
-	// Lunge State
-	bool bIsLunging = false;
-	FVector LungeTargetLocation;
-	float LungeStartTime;
-	
 	UPROPERTY()
 	TArray<AActor*> HitActors;
 
+	/** ComboDamageValues entry set by the active hitbox, or INDEX_NONE to use AttackComboIndex. */
+	int32 HitboxDamageIndex = INDEX_NONE;
+
+	/** Swept path of the hitbox during active frames. */
+	FHitboxSweep HitboxSweep;
+
+	/** Last ActionState sent to the flight recorder. Blueprint writes ActionState too, so changes are picked up in Tick. */
+	ECharacterActionState RecordedActionState = ECharacterActionState::None;
+
+	/** Sweeps the active hitbox and resolves its hits in order. */
+	void SweepMeleeHitbox();
+
+	void ResolveHitboxHit(const FHitResult& Hit);
+
 	/** Starts the jump sequence (starts timer or jumps immediately) */
 	void StartJumpSequence();
 
@@ -551,10 +573,11 @@ public:
 	 * Called via AnimNotify at start of active frames.
 	 * @param SocketName The name of the socket in the Flipbook where the hitbox should spawn (e.g., "HitSocket").
 	 * @param Extent (Optional) The size of the hitbox for this specific attack.
+	 * @param DamageIndex (Optional) Entry of ComboDamageValues for this swing. -1 uses the current combo index.
 	 */
 	
 	UFUNCTION(BlueprintCallable, Category = "Combat")
-	void ActivateMeleeHitbox(FName SocketName, FVector Extent = FVector(30.f, 30.f, 30.f));
+	void ActivateMeleeHitbox(FName SocketName, FVector Extent = FVector(30.f, 30.f, 30.f), int32 DamageIndex = -1);
 
 	/** Deactivates the hitbox. Called via AnimNotify. */
 	UFUNCTION(BlueprintCallable, Category = "Combat")
@@ -563,6 +586,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	void ActivateMask(FName SocketName);
 
+	/**
+	 * Cone scoring of the lunge: the closest candidate within HalfAngle degrees of Direction.
+	 * @param Direction Normalized search direction.
+	 * @return Index into Candidates, or INDEX_NONE.
+	 */
+	static int32 SelectLungeTarget(const FVector& Origin, const FVector& Direction, float HalfAngle, TArrayView<const FVector> Candidates);
+
+	/** One second of mask drain. Returns the new duration and ramps up the drain rate for the next second. */
+	static float DrainMaskDuration(float Duration, float& InOutDrainRateMultiplier, float DrainIncreaseRate);
+
 
 private:
 	/** Helper to reset time dilation back to normal. */
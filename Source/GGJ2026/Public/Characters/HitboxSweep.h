@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UPrimitiveComponent;
+
+/**
+ * Sweeps an active melee hitbox from where it was last frame to where it is now, so a fast lunge or a
+ * low tick rate cannot skip over a hurtbox. Hits carry their sub-frame Time, which lets the frame
+ * pipeline resolve every hitbox's hits in the order they happened within the frame.
+ */
+struct GGJ2026_API FHitboxSweep
+{
+	/** Starts an active window at the hitbox's current transform. */
+	void Begin(const UPrimitiveComponent* Hitbox);
+
+	void End();
+
+	bool IsActive() const { return bActive; }
+
+	/** First hit per actor since the last sweep, sorted by Time. Does nothing while inactive. */
+	void Sweep(UPrimitiveComponent* Hitbox, TArray<FHitResult>& OutHits);
+
+	/** Returns false if Actor was already hit during this active window. */
+	bool MarkHit(const AActor* Actor);
+
+private:
+	FVector LastLocation = FVector::ZeroVector;
+
+	bool bActive = false;
+
+	TArray<TWeakObjectPtr<const AActor>, TInlineAllocator<4>> HitActors;
+};
@@ -0,0 +1,41 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+/**
+ * Reports which collision object types actually pair up. Live counts come from an overlap query per
+ * component against its own responses, so hurtboxes without overlap events, which the overlap lists never
+ * show, are counted like the broadphase sees them. The profile audit flags response setups that create
+ * pairs nobody consumes, like a hurtbox type overlapping itself.
+ *
+ * ggj.Collision.Audit              logs both reports for the current world
+ * ggj.Collision.CheckBudget <N>    fails if the live pair count is above N
+ */
+struct GGJ2026_API FCollisionAudit
+{
+	struct FPairCount
+	{
+		ECollisionChannel A = ECC_WorldStatic;
+		ECollisionChannel B = ECC_WorldStatic;
+		int32 Count = 0;
+	};
+
+	/**
+	 * Pairs of query-enabled components in World whose shapes touch and whose responses do not ignore each
+	 * other, by object type pair, largest first. Components of the same actor are not paired. Returns the total.
+	 */
+	static int32 CountOverlapPairs(const UWorld* World, TArray<FPairCount>& OutCounts);
+
+	/** One line per pair of profiles (or profile with itself) that overlap each other. Returns how many are self pairs. */
+	static int32 AuditProfiles(const FString& ProfilePrefix, TArray<FString>& OutLines);
+
+	static bool IsWithinBudget(const UWorld* World, int32 MaxPairs, int32& OutPairs);
+
+	static void LogReport(const UWorld* World);
+
+	static FString GetChannelName(ECollisionChannel Channel);
+};
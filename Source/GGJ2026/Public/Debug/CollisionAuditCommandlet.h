@@ -0,0 +1,23 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CollisionAuditCommandlet.generated.h"
+
+/**
+ * Audits the collision profiles without running the game:
+ *   UnrealEditor-Cmd GGJ2026.uproject -run=CollisionAudit [-Prefix=GGJ]
+ * Returns non-zero if a profile overlaps its own object type, so it can gate a build.
+ */
+UCLASS()
+class GGJ2026_API UCollisionAuditCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCollisionAuditCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
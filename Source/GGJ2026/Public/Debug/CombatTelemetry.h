@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EGGJCombatEvent : uint8
+{
+	Damage,
+	ContactHit,
+	BuffApplied,
+	BuffRemoved,
+	Death,
+};
+
+/** One combat event. Plain data, so it goes through the ring without locks or allocations. */
+struct FGGJCombatEvent
+{
+	uint64 Cycles = 0;
+
+	/** UObject unique ids, 0 for none. */
+	uint32 SourceId = 0;
+	uint32 TargetId = 0;
+
+	float Value = 0.0f;
+
+	EGGJCombatEvent Type = EGGJCombatEvent::Damage;
+
+	/** Event specific: the mask type of a buff, the archetype of an enemy. */
+	uint8 Param = 0;
+};
+
+/** A telemetry file read back from disk. */
+struct FGGJCombatTelemetryFile
+{
+	double SecondsPerCycle = 0.0;
+	uint64 StartCycles = 0;
+	TArray<FGGJCombatEvent> Events;
+};
+
+/**
+ * Structured combat events written to Saved/Profiling/GGJCombat while recording. The game thread pushes fixed-size
+ * records into a lock-free ring and a background thread drains it into a compact file: cycles are delta encoded,
+ * actor ids are zigzag deltas against the previous event, and both are stored as varints. An event is a few stores
+ * on the game thread, with no formatting and no allocation.
+ *
+ * ggj.CombatTelemetry.Start / Stop, or -GGJCombatTelemetry to record every match.
+ */
+class GGJ2026_API FGGJCombatTelemetry
+{
+public:
+	static constexpr uint32 RingCapacity = 4096;
+
+	/** Running state of the encoder, in the order the events were written. */
+	struct FEncoderState
+	{
+		uint64 Cycles = 0;
+		uint32 SourceId = 0;
+		uint32 TargetId = 0;
+	};
+
+	/** Opens a new file and starts the writer thread. */
+	static void Start();
+
+	/** Writes what is left in the ring and closes the file. */
+	static void Stop();
+
+	static bool IsRecording() { return bRecording; }
+
+	/** Game thread only. Events from other threads, or while the ring is full, are dropped and counted. */
+	static void Record(EGGJCombatEvent Type, const UObject* Source, const UObject* Target, float Value = 0.0f, uint8 Param = 0);
+
+	static int32 GetNumDropped();
+
+	static FString GetTelemetryDir();
+
+	static void WriteHeader(TArray<uint8>& Out, double SecondsPerCycle, uint64 StartCycles);
+
+	static void EncodeEvent(const FGGJCombatEvent& Event, FEncoderState& State, TArray<uint8>& Out);
+
+	/** Returns false on a bad header or a truncated event, keeping the events decoded so far. */
+	static bool Decode(TConstArrayView<uint8> Data, FGGJCombatTelemetryFile& OutFile);
+
+	static bool LoadFile(const FString& Path, FGGJCombatTelemetryFile& OutFile);
+
+private:
+	static bool bRecording;
+};
+
+/** GGJ_COMBAT_EVENT(Damage, Causer, Target, Amount, 0), skipped while nothing is recording. */
+#define GGJ_COMBAT_EVENT(Type, Source, Target, Value, Param) \
+	do \
+	{ \
+		if (FGGJCombatTelemetry::IsRecording()) FGGJCombatTelemetry::Record(EGGJCombatEvent::Type, Source, Target, Value, Param); \
+	} while (0)
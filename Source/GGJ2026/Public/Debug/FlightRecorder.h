@@ -0,0 +1,144 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FlightRecorder.generated.h"
+
+enum class EGGJFlightEvent : uint8
+{
+	Spawn,
+	Destroy,
+	Damage,
+	StateChange,
+	TimerFire,
+	GCBegin,
+	GCEnd,
+};
+
+/** One recorded event. Subject is usually the actor, Detail what happened to it (class, causer, state, timer). */
+struct FGGJFlightEvent
+{
+	uint64 Cycles = 0;
+	FName Subject;
+	FName Detail;
+	float Value = 0.0f;
+	EGGJFlightEvent Type = EGGJFlightEvent::Spawn;
+};
+
+struct FGGJFlightFrame
+{
+	uint64 FrameNumber = 0;
+	uint64 StartCycles = 0;
+	uint64 EndCycles = 0;
+	TArray<FGGJFlightEvent> Events;
+};
+
+/** A dump read back from disk. Names are resolved to strings since FNames do not survive the process. */
+struct FGGJFlightDump
+{
+	double SecondsPerCycle = 0.0;
+	float ThresholdMs = 0.0f;
+	FString BuildVersion;
+	TArray<FString> Names;
+
+	struct FEvent
+	{
+		uint64 Cycles = 0;
+		int32 Subject = INDEX_NONE;
+		int32 Detail = INDEX_NONE;
+		float Value = 0.0f;
+		EGGJFlightEvent Type = EGGJFlightEvent::Spawn;
+	};
+
+	struct FFrame
+	{
+		uint64 FrameNumber = 0;
+		uint64 StartCycles = 0;
+		uint64 EndCycles = 0;
+		TArray<FEvent> Events;
+	};
+
+	TArray<FFrame> Frames;
+};
+
+/**
+ * Always-on recorder of gameplay events on the game thread. Events go into a fixed ring and frames are delimited
+ * by the engine's begin/end frame delegates. When a frame takes longer than ggj.FlightRecorder.HitchMs, the last
+ * ggj.FlightRecorder.DumpFrames frames are written to Saved/Profiling/GGJFlight as a small binary file, which the
+ * FlightRecorder commandlet prints as a timeline:
+ *   UnrealEditor-Cmd GGJ2026.uproject -run=FlightRecorder [-File=<dump>]
+ *
+ * Recording is a few stores per event, with no allocation. Events from other threads are dropped.
+ */
+class GGJ2026_API FGGJFlightRecorder
+{
+public:
+	static constexpr int32 EventCapacity = 8192;
+	static constexpr int32 FrameCapacity = 256;
+
+	/** Hooks the frame and GC delegates once. */
+	static void Install();
+
+	static void Record(EGGJFlightEvent Type, FName Subject, FName Detail = NAME_None, float Value = 0.0f);
+
+	/** Writes the last NumFrames frames, returns the file path or an empty string. */
+	static FString Dump(int32 NumFrames);
+
+	static bool LoadDump(const FString& Path, FGGJFlightDump& OutDump);
+
+	/** One line per frame and per event, times relative to the first frame. */
+	static void FormatTimeline(const FGGJFlightDump& Dump, TArray<FString>& OutLines);
+
+	static const TCHAR* GetEventName(EGGJFlightEvent Type);
+
+	static FString GetDumpDir();
+
+private:
+	static void OnBeginFrame();
+	static void OnEndFrame();
+
+	/** Frames that still have all their events in the ring, oldest first. */
+	static void GetRecentFrames(int32 NumFrames, TArray<FGGJFlightFrame>& OutFrames);
+};
+
+#if !UE_BUILD_SHIPPING
+#define GGJ_FLIGHT_EVENT(Type, Subject, Detail, Value) FGGJFlightRecorder::Record(EGGJFlightEvent::Type, Subject, Detail, Value)
+
+/** Records a timer callback firing, from inside the callback: GGJ_FLIGHT_TIMER(SpawnEnemy). */
+#define GGJ_FLIGHT_TIMER(Function) \
+	do \
+	{ \
+		static const FName GGJFlightTimerName(TEXT(#Function)); \
+		FGGJFlightRecorder::Record(EGGJFlightEvent::TimerFire, GetFName(), GGJFlightTimerName); \
+	} while (0)
+#else
+#define GGJ_FLIGHT_EVENT(Type, Subject, Detail, Value)
+#define GGJ_FLIGHT_TIMER(Function)
+#endif
+
+/** Feeds actor spawns and destroys of its world into the flight recorder. */
+UCLASS()
+class GGJ2026_API UFlightRecorderSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	void OnActorSpawned(AActor* Actor);
+
+	void OnActorDestroyed(AActor* Actor);
+
+	FDelegateHandle ActorSpawnedHandle;
+
+	FDelegateHandle ActorDestroyedHandle;
+};
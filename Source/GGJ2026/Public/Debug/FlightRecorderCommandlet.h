@@ -0,0 +1,23 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "FlightRecorderCommandlet.generated.h"
+
+/**
+ * Prints a flight recorder dump as a timeline:
+ *   UnrealEditor-Cmd GGJ2026.uproject -run=FlightRecorder [-File=<dump>]
+ * Without -File the newest dump in Saved/Profiling/GGJFlight is read.
+ */
+UCLASS()
+class GGJ2026_API UFlightRecorderCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UFlightRecorderCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
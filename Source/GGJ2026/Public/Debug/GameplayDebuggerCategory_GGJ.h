@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+#include "GameplayDebuggerCategory.h"
+
+class AEnemyCharacter;
+class AGGJCharacter;
+class UBoxComponent;
+
+/**
+ * "GGJ" Gameplay Debugger category (apostrophe key, then the category's number). Shows the selected enemy, or the
+ * local player when no enemy is selected: action state, attack token, pool state, animation and movement tier,
+ * running timers and the hitbox active window, which is also drawn in the world while open.
+ */
+class FGameplayDebuggerCategory_GGJ : public FGameplayDebuggerCategory
+{
+public:
+	FGameplayDebuggerCategory_GGJ();
+
+	virtual void CollectData(APlayerController* OwnerPC, AActor* DebugActor) override;
+
+	virtual void DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext) override;
+
+	static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
+
+protected:
+	struct FRepData
+	{
+		FString ActorName;
+		TArray<FString> Lines;
+
+		void Serialize(FArchive& Ar);
+	};
+
+	FRepData DataPack;
+
+	void CollectEnemy(const AEnemyCharacter* Enemy);
+
+	void CollectPlayer(const AGGJCharacter* Player);
+
+	/** Token holders, pool and spawn state of the whole match. */
+	void CollectWorld(UWorld* World);
+
+	void AddHitboxShape(const UBoxComponent* Hitbox, const FString& Description);
+};
+#endif
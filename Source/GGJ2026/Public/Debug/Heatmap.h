@@ -0,0 +1,122 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Debug/SpscRing.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "Heatmap.generated.h"
+
+enum class EGGJHeatmapLayer : uint8
+{
+	PlayerPosition,
+	EnemyDeath,
+	PlayerHit,
+	MaskThrow,
+	Num,
+};
+
+/**
+ * Event counts on a 2D grid over the arena floor, one grid per layer. Cells are sparse since most of the floor
+ * never sees an event. Files hold one match, or many merged by the Heatmap commandlet.
+ */
+struct GGJ2026_API FGGJHeatmap
+{
+	static constexpr int32 NumLayers = static_cast<int32>(EGGJHeatmapLayer::Num);
+
+	float CellSize = 100.0f;
+
+	int32 Matches = 1;
+
+	FString MapName;
+
+	TMap<FIntPoint, uint32> Layers[NumLayers];
+
+	void Add(EGGJHeatmapLayer Layer, float X, float Y);
+
+	/** Adds Other's counts, returns false if the cell sizes differ. */
+	bool Merge(const FGGJHeatmap& Other);
+
+	/** Cells are written row by row as packed deltas. Loading fails on a bad header. */
+	void Serialize(FArchive& Ar);
+
+	bool Save(const FString& Path) const;
+
+	bool Load(const FString& Path);
+
+	/** Square-root scaled black to red to yellow image of one layer, one pixel per cell, +X right and +Y up. */
+	bool SavePng(EGGJHeatmapLayer Layer, const FString& Path) const;
+
+	static const TCHAR* GetLayerName(EGGJHeatmapLayer Layer);
+
+	static FString GetHeatmapDir();
+};
+
+/**
+ * Samples player positions, enemy deaths, player hits and mask throws into a per-match FGGJHeatmap. The game thread
+ * only pushes positions into a lock-free ring; background tasks bin them into the grids and write the file to
+ * Saved/Profiling/GGJHeatmaps when the match timer ends. Created with ggj.Heatmap.Enable 1 or -GGJHeatmap.
+ * Merge many matches into images with:
+ *   UnrealEditor-Cmd GGJ2026.uproject -run=Heatmap [-Dir=<match files>] [-Out=<output dir>]
+ */
+UCLASS()
+class GGJ2026_API UHeatmapSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	/** Starts sampling a new match, finishing the current one first. */
+	void BeginMatch();
+
+	/** Stops sampling and writes the match in the background. */
+	void FinishMatch();
+
+	/** Game thread only. Samples are dropped while the background tasks fall behind. */
+	void AddEvent(EGGJHeatmapLayer Layer, const FVector& Location);
+
+	/** AddEvent on the world's heatmap subsystem, if there is one. */
+	static void Record(const UObject* WorldContext, EGGJHeatmapLayer Layer, const FVector& Location);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	struct FSample
+	{
+		float X;
+		float Y;
+		EGGJHeatmapLayer Layer;
+	};
+
+	using FRing = TGGJSpscRing<FSample, 4096>;
+
+	/** Bins what is in the ring after the previous task is done, then saves to SavePath if set. */
+	void LaunchDrain(const FString& SavePath = FString());
+
+	/** One per match, so the task saving a finished match never pops samples of the next one. */
+	TSharedPtr<FRing> Ring;
+
+	/** The match being recorded. Only the background tasks write to it. */
+	TSharedPtr<FGGJHeatmap> Heatmap;
+
+	/** Tasks run one after another, which keeps a single consumer on the ring. */
+	UE::Tasks::FTask LastTask;
+
+	float TimeUntilSample = 0.0f;
+
+	float TimeUntilDrain = 0.0f;
+
+	int32 NumSamples = 0;
+
+	int32 NumDropped = 0;
+
+	bool bRecording = false;
+};
@@ -0,0 +1,23 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "HeatmapCommandlet.generated.h"
+
+/**
+ * Merges per-match heatmap files into one aggregate per map, written as <Map>.ggjheat plus one PNG per layer:
+ *   UnrealEditor-Cmd GGJ2026.uproject -run=Heatmap [-Dir=<match files>] [-Out=<output dir>]
+ * Dir defaults to Saved/Profiling/GGJHeatmaps and Out to Dir/Merged.
+ */
+UCLASS()
+class GGJ2026_API UHeatmapCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UHeatmapCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,140 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InputReplay.generated.h"
+
+class AGGJCharacter;
+
+/** Input of one local player for one frame: the action values the character's bindings saw. */
+struct FGGJInputFrame
+{
+	enum EButton : uint8
+	{
+		Attack = 1 << 0,
+		Roll = 1 << 1,
+		Jump = 1 << 2,
+		Interact = 1 << 3,
+
+		/** The player existed this frame. */
+		Present = 1 << 7,
+	};
+
+	FVector2f Move = FVector2f::ZeroVector;
+
+	uint8 Buttons = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FGGJInputFrame& Frame)
+	{
+		return Ar << Frame.Move << Frame.Buttons;
+	}
+};
+
+/** Everything needed to play a match again: seeds, time step and the input of every local player per frame. */
+struct GGJ2026_API FGGJInputRecording
+{
+	static constexpr int32 MaxPlayers = 2;
+
+	/** Player locations are stored this often to tell when a replay drifts from the recording. */
+	static constexpr int32 CheckpointInterval = 30;
+
+	FString MapName;
+
+	float FixedDeltaTime = 0.0f;
+
+	int32 SpawnSeed = 0;
+
+	/** AEnemySpawner seeds by actor name, to check the level still matches on replay. */
+	TMap<FString, int32> SpawnerSeeds;
+
+	/** MaxPlayers entries per frame. */
+	TArray<FGGJInputFrame> Frames;
+
+	/** MaxPlayers locations per checkpoint. */
+	TArray<FVector3f> Checkpoints;
+
+	int32 GetNumFrames() const { return Frames.Num() / MaxPlayers; }
+
+	void Serialize(FArchive& Ar);
+
+	bool Save(const FString& Path) const;
+
+	bool Load(const FString& Path);
+
+	static FString GetRecordingDir();
+};
+
+/**
+ * Records the Enhanced Input action values of every local player each frame, with the spawn seeds and a fixed
+ * time step, and plays them back by injecting the same values, so two builds can be benchmarked on the same match:
+ *   -GGJRecordInput[=<file>]           record the match, saved when the world ends
+ *   -GGJReplay=<file> [-GGJReplayExit] replay it, headless with -nullrhi, and exit when the input runs out
+ * Combine the replay with -GGJPerfCapture to measure it; the capture bots stand down while a replay runs.
+ * Randomness outside the spawn flow, such as behavior tree or Blueprint random nodes, is not covered.
+ */
+UCLASS()
+class GGJ2026_API UInputReplaySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	bool IsRecording() const { return bRecording; }
+
+	bool IsReplaying() const { return bReplaying; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Character of each local player slot, null for slots without one. */
+	void GetLocalCharacters(TArray<AGGJCharacter*, TInlineAllocator<FGGJInputRecording::MaxPlayers>>& OutCharacters) const;
+
+	void CaptureFrame();
+
+	void InjectFrame(int32 FrameIndex);
+
+	void CheckDrift();
+
+	void FinishReplay();
+
+	/** Sleeps so frames take at least the recording's fixed delta in real time. */
+	void ThrottleToFixedRate();
+
+	FGGJInputRecording Recording;
+
+	FString RecordingPath;
+
+	/** Frames recorded, or replayed so far. */
+	int32 Frame = 0;
+
+	float MaxDrift = 0.0f;
+
+	int32 FirstDriftFrame = INDEX_NONE;
+
+	bool bRecording = false;
+
+	bool bReplaying = false;
+
+	// FApp time step settings from before this subsystem fixed them, restored on deinit
+	bool bOverrodeTimeStep = false;
+
+	bool bPreviousUseFixedTimeStep = false;
+
+	double PreviousFixedDeltaTime = 0.0;
+
+	bool bThrottleToFixedRate = false;
+
+	/** Real time the next frame may start at while throttling. */
+	double NextFrameRealTime = 0.0;
+};
@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectArray.h"
+
+/**
+ * Live counts of the game's own UObjects and actors per class, with high-water marks, to catch leaks in
+ * pooling and spawn/destroy cycles. An object counts when its closest native class comes from this module,
+ * so Blueprint subclasses are listed under their own name. Counts follow UObject creation and deletion, so an
+ * object stays live until garbage collection has purged it.
+ *
+ * ggj.Objects.Start     starts tracking, counting the objects that already exist
+ * ggj.Objects.Stop      stops tracking
+ * ggj.Objects.Report    logs the counts, largest first
+ *
+ * Also started by -GGJObjectAccounting, with the high-water marks reset at the start of every match.
+ */
+class GGJ2026_API FGGJObjectAccounting : public FUObjectArray::FUObjectCreateListener, public FUObjectArray::FUObjectDeleteListener
+{
+public:
+	struct FClassCount
+	{
+		int32 Live = 0;
+		int32 HighWater = 0;
+
+		/** Created since tracking started. */
+		int32 Created = 0;
+	};
+
+	static FGGJObjectAccounting& Get();
+
+	void Start();
+
+	void Stop();
+
+	bool IsRunning() const { return bRunning; }
+
+	/** Restarts the high-water marks from the current live counts. */
+	void ResetHighWater();
+
+	/** Copy of the counts by class name. */
+	TMap<FName, FClassCount> GetCounts() const;
+
+	/** Live count of one class, 0 if none was seen. */
+	int32 GetLiveCount(FName ClassName) const;
+
+	void LogReport() const;
+
+	/** True for classes whose closest native class is defined in this module. */
+	static bool IsGameClass(const UClass* Class);
+
+	//~ FUObjectCreateListener / FUObjectDeleteListener
+	virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+	virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override;
+	virtual void OnUObjectArrayShutdown() override;
+
+private:
+	void Add(const UObjectBase* Object, int32 Index, bool bCreated);
+
+	mutable FCriticalSection Lock;
+
+	TMap<FName, FClassCount> Counts;
+
+	/** Class name of every tracked object by object index, so deletes never touch a class that may be gone. */
+	TMap<int32, FName> TrackedObjects;
+
+	bool bRunning = false;
+};
@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "PerfCaptureSettings.generated.h"
+
+/**
+ * Scenario and budgets for the headless performance capture, read from [/Script/GGJ2026.PerfCaptureSettings]
+ * in DefaultGame.ini. Every value can be overridden on the command line as -Perf<Name>=<Value>,
+ * e.g. -PerfDuration=120 -PerfMaxEnemies=80.
+ */
+UCLASS(Config = Game, DefaultConfig)
+class GGJ2026_API UPerfCaptureSettings : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Seconds recorded after the warm-up. */
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	float Duration = 60.0f;
+
+	/** Seconds played before recording starts, so loading and the first spawns are not measured. */
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	float WarmupSeconds = 5.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	int32 MaxEnemies = 40;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	int32 MaxActiveEnemies = 20;
+
+	/** Seconds between spawns. */
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	float SpawnRate = 1.0f;
+
+	/** Used when the level has not set an enemy class on the spawner yet. */
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	FSoftClassPath EnemyClass;
+
+	/** Dummy player spawned by the automation benchmarks, which run without a game mode. */
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	FSoftClassPath PlayerClass;
+
+	/** Local players driven by the capture, 1 or 2. */
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	int32 BotPlayers = 2;
+
+	/** Bots pick a new walking direction this often, and attack twice as often. */
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	float BotDecisionInterval = 1.0f;
+
+	/** Same seed, same bot inputs. */
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	int32 Seed = 2026;
+
+	/** A frame with a spawn is a spawn hitch if its game thread time is above this. */
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	float SpawnHitchMs = 20.0f;
+
+	/** Budgets, 0 disables the check. */
+	UPROPERTY(Config, EditAnywhere, Category = "Budgets")
+	float BudgetP50Ms = 8.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Budgets")
+	float BudgetP95Ms = 12.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Budgets")
+	float BudgetP99Ms = 16.6f;
+
+	/** Negative disables the check, 0 allows no hitch at all. */
+	UPROPERTY(Config, EditAnywhere, Category = "Budgets")
+	int32 BudgetSpawnHitches = 0;
+
+	/**
+	 * Mean growth of used memory per frame, in KB. Stands in for allocations per frame: the allocator keeps no
+	 * call counts in regular builds, use -trace=memory with Insights for those.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Budgets")
+	float BudgetMemoryGrowthKBPerFrame = 0.0f;
+
+	/** Applies -Perf<Name>=<Value> overrides from CommandLine. */
+	void ApplyCommandLine(const TCHAR* CommandLine);
+};
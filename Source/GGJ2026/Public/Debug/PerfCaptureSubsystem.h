@@ -0,0 +1,113 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PerfCaptureSubsystem.generated.h"
+
+class AGGJCharacter;
+class UPerfCaptureSettings;
+
+/** What one capture measured, and which budgets it broke. */
+struct GGJ2026_API FPerfCaptureSummary
+{
+	int32 Frames = 0;
+
+	float GameThreadP50Ms = 0.0f;
+	float GameThreadP95Ms = 0.0f;
+	float GameThreadP99Ms = 0.0f;
+	float GameThreadMaxMs = 0.0f;
+
+	int32 Spawns = 0;
+
+	/** Frames with a spawn whose game thread time was above the hitch threshold. */
+	int32 SpawnHitches = 0;
+
+	float MemoryGrowthKBPerFrame = 0.0f;
+
+	TArray<FString> BudgetFailures;
+
+	bool IsWithinBudget() const { return BudgetFailures.Num() == 0; }
+
+	FString ToString() const;
+};
+
+/**
+ * Repeatable headless frame-cost measurement. Forces the spawner settings from UPerfCaptureSettings,
+ * drives one or two players with seeded random input, records the CSV profiler for the configured
+ * duration and logs p50/p95/p99 game thread times, spawn hitches and memory growth per frame.
+ *
+ * Runs without a GPU:
+ *   UnrealEditor-Cmd GGJ2026.uproject /Game/Maps/E_MainLevel -game -nullrhi -nosound -unattended -GGJPerfCapture
+ * The process exits with code 1 if a budget is exceeded. ggj.Perf.Capture starts the same capture in a
+ * running game, e.g. through -ExecCmds, without exiting at the end.
+ */
+UCLASS()
+class GGJ2026_API UPerfCaptureSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	struct FFrameSample
+	{
+		float GameThreadMs = 0.0f;
+		bool bSpawned = false;
+	};
+
+	struct FBotState
+	{
+		TWeakObjectPtr<AGGJCharacter> Player;
+		FVector2D Direction = FVector2D::ZeroVector;
+		float NextDecisionTime = 0.0f;
+		float NextAttackTime = 0.0f;
+	};
+
+	UPROPERTY()
+	UPerfCaptureSettings* Settings;
+
+	FRandomStream Random;
+
+	TArray<FFrameSample> Samples;
+
+	TArray<FBotState> Bots;
+
+	float ElapsedTime = 0.0f;
+
+	bool bCapturing = false;
+
+	bool bRecording = false;
+
+	bool bExitWhenDone = false;
+
+	int32 LastNumSpawned = 0;
+
+	uint64 RecordingStartMemory = 0;
+
+	void ApplyScenario();
+
+	void DriveBots();
+
+	void BeginRecording();
+
+	void FinishCapture();
+
+	FPerfCaptureSummary Summarize() const;
+
+public:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	/** Starts a capture with the configured settings and command line overrides. */
+	void StartCapture(bool bInExitWhenDone);
+
+	bool IsCapturing() const { return bCapturing; }
+
+	/** Value at Percentile (0-100) of already sorted values, nearest rank. */
+	static float GetPercentile(TConstArrayView<float> SortedValues, float Percentile);
+};
@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class APlayerController;
+class UCanvas;
+
+#if !UE_BUILD_SHIPPING
+/**
+ * On-screen summary of what the match is costing, toggled with ggj.perf [0/1]: enemy, pool and spawn counts,
+ * masks in flight, path queue, crowd agents, game thread time and the game thread ms of every GGJ cycle stat
+ * averaged over recent frames. The per-system times come from FGGJStatTimings, recorded while the overlay is shown.
+ */
+class GGJ2026_API FGGJPerfOverlay
+{
+public:
+	static void SetVisible(bool bVisible);
+
+	static bool IsVisible();
+
+private:
+	static void Draw(UCanvas* Canvas, APlayerController* PC);
+
+	/** Turns the stat timing totals into per-frame ms, once per frame. */
+	static void SampleTimings();
+};
+#endif
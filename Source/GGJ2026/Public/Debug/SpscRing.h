@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+#include <type_traits>
+
+/**
+ * Fixed-size lock-free ring for exactly one producer thread and one consumer thread. Push and Pop never block
+ * or allocate; Push fails when the ring is full. Items are copied by value, so keep them plain data.
+ */
+template <typename T, uint32 Capacity>
+class TGGJSpscRing
+{
+	static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+	static_assert(std::is_trivially_copyable_v<T>, "Ring items are copied between threads without constructors");
+
+public:
+	/** Producer only. */
+	bool Push(const T& Item)
+	{
+		const uint32 Write = WriteIndex.load(std::memory_order_relaxed);
+		if (Write - ReadIndex.load(std::memory_order_acquire) == Capacity) return false;
+
+		Items[Write & (Capacity - 1)] = Item;
+		WriteIndex.store(Write + 1, std::memory_order_release);
+		return true;
+	}
+
+	/** Consumer only. */
+	bool Pop(T& OutItem)
+	{
+		const uint32 Read = ReadIndex.load(std::memory_order_relaxed);
+		if (Read == WriteIndex.load(std::memory_order_acquire)) return false;
+
+		OutItem = Items[Read & (Capacity - 1)];
+		ReadIndex.store(Read + 1, std::memory_order_release);
+		return true;
+	}
+
+	/** Approximate from either side, exact while the other side is idle. */
+	uint32 Num() const
+	{
+		return WriteIndex.load(std::memory_order_acquire) - ReadIndex.load(std::memory_order_acquire);
+	}
+
+private:
+	// Producer and consumer indices on separate cache lines so they do not invalidate each other
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> WriteIndex{0};
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> ReadIndex{0};
+	alignas(PLATFORM_CACHE_LINE_SIZE) T Items[Capacity];
+};
@@ -23,9 +23,16 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	/** Seeded from UEnemySpawnerManager in BeginPlay. */
+	FRandomStream Random;
+
 public:	
 	FVector GetSpawnLocation();
 	
+	void SetRandomSeed(int32 Seed) { Random.Initialize(Seed); }
+	
+	int32 GetRandomSeed() const { return Random.GetInitialSeed(); }
+	
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
 
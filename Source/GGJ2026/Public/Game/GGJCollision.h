@@ -0,0 +1,25 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Names for the custom collision channels and profiles in DefaultEngine.ini.
+ * Combat volumes take their responses from these profiles instead of setting them up in constructors.
+ */
+namespace GGJCollision
+{
+	inline constexpr ECollisionChannel Player = ECC_GameTraceChannel1;
+	inline constexpr ECollisionChannel Enemy = ECC_GameTraceChannel2;
+	inline constexpr ECollisionChannel PlayerHitbox = ECC_GameTraceChannel3;
+	inline constexpr ECollisionChannel EnemyHurtbox = ECC_GameTraceChannel4;
+	inline constexpr ECollisionChannel EnemyHitbox = ECC_GameTraceChannel5;
+	inline constexpr ECollisionChannel PlayerHurtbox = ECC_GameTraceChannel6;
+
+	inline const FName PlayerHurtboxProfile(TEXT("GGJPlayerHurtbox"));
+	inline const FName PlayerHitboxProfile(TEXT("GGJPlayerHitbox"));
+	inline const FName EnemyHurtboxProfile(TEXT("GGJEnemyHurtbox"));
+	inline const FName EnemyHitboxProfile(TEXT("GGJEnemyHitbox"));
+	inline const FName MaskDamageProfile(TEXT("GGJMaskDamage"));
+}
@@ -44,6 +44,8 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	
 private:	
 	void AssignSharedCamera(APlayerController* Controller);
 };
@@ -0,0 +1,173 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * Gameplay instrumentation. Cycle and counter stats show in "stat GGJ"; the same hot paths emit
+ * CPU events on the GGJCombat, GGJAI, GGJSpawn and GGJCamera trace channels for Unreal Insights
+ * (-trace=cpu,counters,GGJCombat,GGJAI,GGJSpawn,GGJCamera), and the cycle stats also land in the GGJ CSV profiler
+ * category. Everything compiles out in Shipping.
+ */
+DECLARE_STATS_GROUP(TEXT("GGJ"), STATGROUP_GGJ, STATCAT_Advanced);
+
+// Cycle stats
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Player Tick"), STAT_GGJPlayerTick, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Find Best Target"), STAT_GGJFindBestTarget, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hitbox Overlap"), STAT_GGJHitboxOverlap, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resolve Hits"), STAT_GGJResolveHits, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Tick"), STAT_GGJEnemyTick, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn Enemy"), STAT_GGJSpawnEnemy, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Camera Update"), STAT_GGJCameraUpdate, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Camera Clamp Players"), STAT_GGJCameraClamp, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Controller"), STAT_GGJAIController, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Path Broker"), STAT_GGJPathBroker, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Steering"), STAT_GGJSteering, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hitbox Sweep"), STAT_GGJHitboxSweep, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Take Damage"), STAT_GGJTakeDamage, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Flush Damage"), STAT_GGJFlushDamage, STATGROUP_GGJ, GGJ2026_API);
+
+// Gauges, kept until changed
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Enemies"), STAT_GGJActiveEnemies, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Enemy Pool Size"), STAT_GGJEnemyPoolSize, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Attack Token Holders"), STAT_GGJTokenHolders, STATGROUP_GGJ, GGJ2026_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Masks In Flight"), STAT_GGJMasksInFlight, STATGROUP_GGJ, GGJ2026_API);
+
+// Per-frame counters, reset every frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hits"), STAT_GGJHits, STATGROUP_GGJ, GGJ2026_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(GGJ2026_API, GGJ);
+
+/**
+ * Per-hit combat messages, Verbose so they stay quiet unless asked for ("log LogGGJCombat Verbose").
+ * Compiled out of Shipping, format strings included. Structured events go to FGGJCombatTelemetry.
+ */
+#if UE_BUILD_SHIPPING
+GGJ2026_API DECLARE_LOG_CATEGORY_EXTERN(LogGGJCombat, Log, NoLogging);
+#else
+GGJ2026_API DECLARE_LOG_CATEGORY_EXTERN(LogGGJCombat, Log, All);
+#endif
+
+/** Collision audit findings, shared by the in-game audit and its commandlet. */
+GGJ2026_API DECLARE_LOG_CATEGORY_EXTERN(LogGGJCollision, Log, All);
+
+/** Flight recorder dumps and their commandlet. */
+GGJ2026_API DECLARE_LOG_CATEGORY_EXTERN(LogGGJFlightRecorder, Log, All);
+
+/** Heatmap recording and export, shared with the heatmap commandlet. */
+GGJ2026_API DECLARE_LOG_CATEGORY_EXTERN(LogGGJHeatmap, Log, All);
+
+#define GGJ_TRACE_ENABLED (CPUPROFILERTRACE_ENABLED && !UE_BUILD_SHIPPING)
+#define GGJ_COUNTERS_TRACE_ENABLED (COUNTERSTRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if GGJ_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(GGJCombatChannel, GGJ2026_API);
+UE_TRACE_CHANNEL_EXTERN(GGJAIChannel, GGJ2026_API);
+UE_TRACE_CHANNEL_EXTERN(GGJSpawnChannel, GGJ2026_API);
+UE_TRACE_CHANNEL_EXTERN(GGJCameraChannel, GGJ2026_API);
+
+/** Scoped CPU event on one of the GGJ channels: GGJ_TRACE_SCOPE(Combat, "Name"). */
+#define GGJ_TRACE_SCOPE(Channel, Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, GGJ##Channel##Channel)
+#else
+#define GGJ_TRACE_SCOPE(Channel, Name)
+#endif
+
+#if !UE_BUILD_SHIPPING
+/**
+ * In-process totals of the GGJ cycle stats, for benchmarks that need the numbers back without a stats
+ * capture. Off unless a benchmark starts it; only game thread scopes are recorded.
+ */
+struct GGJ2026_API FGGJStatTimings
+{
+	struct FEntry
+	{
+		double Seconds = 0.0;
+		int32 Calls = 0;
+	};
+
+	/** Clears previous totals and starts recording. */
+	static void Start();
+
+	static void Stop();
+
+	static bool IsRecording() { return bRecording; }
+
+	static void Add(const FName& StatName, double Seconds);
+
+	static const TMap<FName, FEntry>& GetTotals();
+
+private:
+	static bool bRecording;
+};
+
+struct FGGJScopedStatTiming
+{
+	explicit FGGJScopedStatTiming(const FName& InStatName)
+		: StatName(InStatName)
+		, StartTime(FGGJStatTimings::IsRecording() && IsInGameThread() ? FPlatformTime::Seconds() : 0.0)
+	{
+	}
+
+	~FGGJScopedStatTiming()
+	{
+		if (StartTime > 0.0) FGGJStatTimings::Add(StatName, FPlatformTime::Seconds() - StartTime);
+	}
+
+	const FName& StatName;
+	double StartTime;
+};
+
+/** The name is built once per scope, not on every call while recording. */
+#define GGJ_SCOPE_STAT_TIMING(Stat) \
+	static const FName PREPROCESSOR_JOIN(GGJStatTimingName, __LINE__)(TEXT(#Stat)); \
+	FGGJScopedStatTiming PREPROCESSOR_JOIN(GGJStatTiming, __LINE__)(PREPROCESSOR_JOIN(GGJStatTimingName, __LINE__))
+#else
+#define GGJ_SCOPE_STAT_TIMING(Stat)
+#endif
+
+/** Cycle stat, CSV timing, benchmark timing and trace event for the same scope. */
+#define GGJ_SCOPE_CYCLE_COUNTER(Stat, Channel) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	CSV_SCOPED_TIMING_STAT(GGJ, Stat); \
+	GGJ_SCOPE_STAT_TIMING(Stat); \
+	GGJ_TRACE_SCOPE(Channel, #Stat)
+
+#if GGJ_COUNTERS_TRACE_ENABLED
+TRACE_DECLARE_INT_COUNTER_EXTERN(GGJActiveEnemies);
+TRACE_DECLARE_INT_COUNTER_EXTERN(GGJEnemyPoolSize);
+TRACE_DECLARE_INT_COUNTER_EXTERN(GGJTokenHolders);
+TRACE_DECLARE_INT_COUNTER_EXTERN(GGJMasksInFlight);
+TRACE_DECLARE_INT_COUNTER_EXTERN(GGJHitsPerFrame);
+
+#define GGJ_TRACE_COUNTER_SET(Counter, Value) TRACE_COUNTER_SET(GGJ##Counter, Value)
+#else
+#define GGJ_TRACE_COUNTER_SET(Counter, Value)
+#endif
+
+/** Sets a gauge in both stats and trace: GGJ_SET_GAUGE(ActiveEnemies, Num). */
+#define GGJ_SET_GAUGE(Name, Value) \
+	do \
+	{ \
+		const int32 GGJGaugeValue = (Value); \
+		SET_DWORD_STAT(STAT_GGJ##Name, GGJGaugeValue); \
+		GGJ_TRACE_COUNTER_SET(Name, GGJGaugeValue); \
+	} while (0)
+
+/**
+ * Low Level Memory Tracker tags, nested under GGJ (-llm, "stat LLM" or the LLM tracks in Insights).
+ * Scope allocations with LLM_SCOPE_BYTAG(GGJ_Enemies).
+ */
+LLM_DECLARE_TAG_API(GGJ, GGJ2026_API);
+LLM_DECLARE_TAG_API(GGJ_Enemies, GGJ2026_API);
+LLM_DECLARE_TAG_API(GGJ_AI, GGJ2026_API);
+LLM_DECLARE_TAG_API(GGJ_Masks, GGJ2026_API);
+LLM_DECLARE_TAG_API(GGJ_Dialogue, GGJ2026_API);
+LLM_DECLARE_TAG_API(GGJ_UI, GGJ2026_API);
+LLM_DECLARE_TAG_API(GGJ_Camera, GGJ2026_API);
@@ -0,0 +1,169 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Animation/CombatAnimNotifies.h"
+#include "GameplayFramePipeline.generated.h"
+
+class AGGJCharacter;
+class AEnemyCharacter;
+
+/**
+ * Runs the per-frame character work in a fixed order instead of leaving it to actor tick order:
+ * sense -> decide -> steer -> hit resolution -> damage -> presentation.
+ * Sensing, facing and attack slot scoring only read a snapshot taken at the start of the frame,
+ * so they run as UE::Tasks on worker threads while the game thread resolves hits and damage.
+ * Everything that touches a UObject happens on the game thread. Free attack tokens go to the best
+ * scored enemies instead of whichever asks first.
+ */
+UCLASS()
+class GGJ2026_API UGameplayFramePipeline : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	/** Copy of the state the worker stages read. Never touched by the game thread while tasks run. */
+	struct FCharacterSnapshot
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector Velocity = FVector::ZeroVector;
+		FVector LastFacingDirection = FVector::ForwardVector;
+		float CameraYaw = 0.0f;
+		bool bTargetable = true;
+		bool bHoldsAttackToken = false;
+	};
+
+	struct FFacingResult
+	{
+		FVector FacingDirection = FVector::ForwardVector;
+		float AnimDirection = 0.0f;
+		bool bFlipped = false;
+	};
+
+	struct FEnemyFrameResult
+	{
+		TWeakObjectPtr<AGGJCharacter> Target;
+		float TargetDistance = 0.0f;
+		float AttackSlotScore = 0.0f;
+		bool bAttackSlotCandidate = false;
+	};
+
+	struct FPendingDamage
+	{
+		TWeakObjectPtr<AActor> Target;
+		float Amount = 0.0f;
+		TWeakObjectPtr<AController> Instigator;
+		TWeakObjectPtr<AActor> Causer;
+	};
+
+	struct FQueuedNotify
+	{
+		TWeakObjectPtr<AEnemyCharacter> Enemy;
+		ECombatNotifyType Type = ECombatNotifyType::ActivateHitbox;
+		FName SocketName;
+		FVector Extent = FVector::ZeroVector;
+	};
+
+	/** Players further away than this are never sensed as targets. */
+	UPROPERTY(EditAnywhere, Category = "Pipeline")
+	float SenseRadius = 2500.0f;
+
+	UPROPERTY()
+	TArray<AGGJCharacter*> Players;
+
+	UPROPERTY()
+	TArray<AEnemyCharacter*> Enemies;
+
+	// Per-frame packed data, indexed like FramePlayers / FrameEnemies
+	TArray<AGGJCharacter*> FramePlayers;
+	TArray<AEnemyCharacter*> FrameEnemies;
+	TArray<FCharacterSnapshot> PlayerSnapshots;
+	TArray<FCharacterSnapshot> EnemySnapshots;
+	TArray<FFacingResult> PlayerFacings;
+	TArray<FFacingResult> EnemyFacings;
+	TArray<int32> EnemyTargets;
+	TArray<float> EnemyTargetDistances;
+	TArray<float> EnemySlotScores;
+
+	/** Enemies the free attack tokens go to this frame, best slot score first. */
+	TArray<int32> SlotCandidates;
+
+	/** Attack tokens nobody held when the frame was gathered. */
+	int32 FreeAttackSlots = 0;
+
+	/** Results of the last completed frame, safe to query from the game thread at any time. */
+	TMap<const AEnemyCharacter*, FEnemyFrameResult> PublishedEnemyResults;
+
+	TArray<FPendingDamage> PendingDamage;
+
+	TArray<FQueuedNotify> PendingNotifies;
+
+	bool bResolvingHits = false;
+
+	/** Damage applications since the last tick, published as a trace counter. */
+	int32 HitsThisFrame = 0;
+
+	void GatherFrame();
+
+	void SenseTargets();
+
+	void ComputeFacings();
+
+	void ScoreAttackSlots();
+
+	void FlushEnemyNotifies();
+
+	void ResolveHits();
+
+	void FlushDamage();
+
+	void ApplyFrame();
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	void RegisterPlayer(AGGJCharacter* Player);
+
+	void UnregisterPlayer(AGGJCharacter* Player);
+
+	void RegisterEnemy(AEnemyCharacter* Enemy);
+
+	void UnregisterEnemy(AEnemyCharacter* Enemy);
+
+	/** Queues a combat notify raised by an enemy's animation. Applied in order at the start of hit resolution. */
+	void QueueEnemyNotify(AEnemyCharacter* Enemy, ECombatNotifyType Type, FName SocketName = NAME_None, const FVector& Extent = FVector::ZeroVector);
+
+	/**
+	 * Applies damage now, or defers it to the damage stage if called while hits are being resolved.
+	 * Use this instead of UGameplayStatics::ApplyDamage from hitbox overlap callbacks.
+	 */
+	static void ApplyDamage(AActor* Target, float Amount, AController* Instigator, AActor* Causer);
+
+	/**
+	 * Facing used by the directional flipbooks. Pure function of the inputs so it can run off the game thread.
+	 * @param Velocity Current velocity; only updates the facing when moving.
+	 * @param LastFacingDirection Previous facing, kept when standing still.
+	 * @param CameraYaw Yaw of the camera the sprite is seen through.
+	 */
+	static void ComputeFacing(const FVector& Velocity, const FVector& LastFacingDirection, float CameraYaw, FVector& OutFacingDirection, float& OutAnimDirection, bool& bOutFlipped);
+
+	/** Closest living player sensed by this enemy last frame, or null. */
+	UFUNCTION(BlueprintCallable, Category = "Pipeline")
+	AGGJCharacter* GetSensedTarget(const AEnemyCharacter* Enemy) const;
+
+	/** How well placed this enemy is to take an attack slot, from 0 (not at all) to 1. */
+	UFUNCTION(BlueprintCallable, Category = "Pipeline")
+	float GetAttackSlotScore(const AEnemyCharacter* Enemy) const;
+
+	/**
+	 * Whether a free attack token should go to this enemy: it was among the best scored enemies last frame.
+	 * Always true for enemies the pipeline does not drive, so they keep first-come tokens.
+	 */
+	bool IsAttackSlotCandidate(const AEnemyCharacter* Enemy) const;
+};
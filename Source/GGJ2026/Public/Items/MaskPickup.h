@@ -47,11 +47,25 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mask|Combat")
 	float RotationSpeed = 720.0f;
 	
+	/** World-space radius around the mask that must leave the view before a thrown mask is destroyed. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mask|Combat")
+	float OffScreenRadius = 100.0f;
+	
+	/** Without a camera view (-nullrhi, servers) nothing is off-screen, thrown masks are destroyed after this long instead. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mask|Combat")
+	float HeadlessFlightTime = 5.0f;
+	
 	void InitializeThrow(FVector Direction, AActor* InShooter);
 	
+	/** Thrown masks that are still alive in World. */
+	static int32 GetNumInFlight(const UWorld* World);
+	
 	bool IsFlying() const { return bIsFlying; }
 	
 	void UpdateVisuals(class UPaperFlipbook* RedBook, UPaperFlipbook* GreenBook,UPaperFlipbook* BlueBook);
+	
+	/** Sets the flipbook directly when the caller already knows the one for MaskType. */
+	void SetMaskFlipbook(UPaperFlipbook* Book);
 
 	/** Mask type, editable per instance. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mask")
@@ -60,6 +74,7 @@ public:
 protected:
 	virtual void Tick(float DeltaTime) override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
 	UFUNCTION()
 	void OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComponent,int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
@@ -69,8 +84,15 @@ protected:
 
 private:
 	bool bIsFlying = false;
+	
+	/** Time since the current throw. */
+	float FlightTime = 0.0f;
+	
 	UPROPERTY()
 	AActor* Shooter;
 	
-	void CheckOffScreen();
+	/** Enemies damaged by the current throw. Capsule and hurtbox can both begin overlapping, each enemy is hit once. */
+	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<8>> DamagedActors;
+	
+	void CheckOffScreen(float DeltaTime);
 };
\ No newline at end of file
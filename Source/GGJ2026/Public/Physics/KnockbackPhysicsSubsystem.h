@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "KnockbackPhysicsSubsystem.generated.h"
+
+class APawn;
+class FKnockbackSimCallback;
+
+/**
+ * Opt-in knockback on the Chaos solver (ggj.Physics.AsyncKnockback). Damage callbacks queue an impulse
+ * instead of launching the character; the decay is integrated in a sim callback on the physics thread
+ * and the resulting displacement is read back and swept on the game thread the next frame.
+ * With "Tick Physics Async" enabled the solver runs at a fixed step, so the same input sequence
+ * produces the same knockback. This is about determinism and keeping launches out of damage callbacks,
+ * not game thread cost: only the decay runs on the physics thread, the sweep, which is most of the work,
+ * stays on the game thread.
+ * While the knockback runs the pawn's own movement is held: CharacterMovement is put in MOVE_None, other
+ * movement components are deactivated, so path following cannot steer against it. Velocity is set from the
+ * displacement so animation speed still sees the push.
+ */
+UCLASS()
+class GGJ2026_API UKnockbackPhysicsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	/** Exponential damping of knockback velocity on the physics thread, per second. */
+	UPROPERTY(EditAnywhere, Category = "Knockback")
+	float Damping = 8.0f;
+
+	FKnockbackSimCallback* SimCallback = nullptr;
+
+	/** Ids handed to the physics thread, which never sees the pawns themselves. */
+	TMap<TWeakObjectPtr<APawn>, int32> PawnIds;
+	TMap<int32, TWeakObjectPtr<APawn>> IdPawns;
+	int32 NextId = 0;
+
+	/** Orders commands so the physics thread applies each one once, even when several substeps see the input. */
+	int32 NextSequence = 0;
+
+	/** Displacement read back this frame, per id. */
+	TMap<int32, FVector> PendingDisplacements;
+
+	struct FActiveKnockback
+	{
+		/** Game thread estimate of when the physics thread drops the velocity. */
+		float TimeLeft = 0.0f;
+		
+		/** The pawn's movement was held by BeginKnockback and is given back when the knockback ends. */
+		bool bHeldMovement = false;
+	};
+	
+	/** Knockbacks running on the physics thread, per id. */
+	TMap<int32, FActiveKnockback> ActiveKnockbacks;
+
+	int32 GetOrAddId(APawn* Pawn);
+	
+	/** Holds the pawn's own movement while the physics thread pushes it. */
+	static bool BeginKnockback(APawn* Pawn);
+	
+	static void EndKnockback(APawn* Pawn);
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	/** True while the CVar is on and the solver callback is registered. */
+	bool IsEnabled() const;
+
+	/**
+	 * Queues a knockback for the physics thread, replacing any knockback still running on that pawn.
+	 * Returns false when async knockback is off, the caller should launch the character itself.
+	 */
+	static bool QueueKnockback(APawn* Pawn, const FVector& KnockbackVelocity);
+	
+	/**
+	 * Stops any knockback on Pawn and forgets its id, without giving its movement back.
+	 * For pawns that die or go back to a pool, whose movement is reset by their owner.
+	 */
+	static void CancelKnockback(APawn* Pawn);
+};